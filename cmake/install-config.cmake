@@ -1 +1,31 @@
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
+
+# the optional BLAS and LAPACK backends are linked publicly, so consumers have to find them as well;
+# this file is configured with the options that the package was built with
+if(@elecstruct_USE_BLAS@)
+  find_dependency(BLAS)
+endif()
+
+if(@elecstruct_USE_LAPACKE@)
+  find_dependency(LAPACK)
+
+  # the LAPACKE library has no find module, so it is searched for the same way as in the build; consumers
+  # can set elecstruct_LAPACKE_LIBRARY to the library that provides the LAPACKE functions
+  if(NOT TARGET elecstruct::lapacke)
+    find_library(elecstruct_LAPACKE_LIBRARY NAMES lapacke)
+    if(NOT elecstruct_LAPACKE_LIBRARY)
+      set(elecstruct_FOUND FALSE)
+      set(
+          elecstruct_NOT_FOUND_MESSAGE
+          "Could not find the LAPACKE library; set elecstruct_LAPACKE_LIBRARY to the library that provides it"
+      )
+      return()
+    endif()
+
+    add_library(elecstruct::lapacke UNKNOWN IMPORTED)
+    set_target_properties(elecstruct::lapacke PROPERTIES IMPORTED_LOCATION "${elecstruct_LAPACKE_LIBRARY}")
+  endif()
+endif()
+
 include("${CMAKE_CURRENT_LIST_DIR}/elecstructTargets.cmake")
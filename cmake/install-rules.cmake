@@ -45,10 +45,16 @@ set(
 )
 mark_as_advanced(elecstruct_INSTALL_CMAKEDIR)
 
+# the config finds the optional dependencies that this build was configured with
+configure_file(
+    cmake/install-config.cmake
+    "${PROJECT_BINARY_DIR}/${package}Config.cmake"
+    @ONLY
+)
+
 install(
-    FILES cmake/install-config.cmake
+    FILES "${PROJECT_BINARY_DIR}/${package}Config.cmake"
     DESTINATION "${elecstruct_INSTALL_CMAKEDIR}"
-    RENAME "${package}Config.cmake"
     COMPONENT elecstruct_Development
 )
 
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <elecstruct/elecstruct.hpp>
+
+/*
+    Runs the restricted Hartree-Fock calculations for every input toml file in a directory (or listed
+    in a manifest file) in a single process, and writes one result line per calculation to stdout.
+*/
+
+auto main(int argc, const char** argv) -> int
+{
+    if (argc < 2 || argc > 4) {
+        std::cerr << "./a.out path/to/directory_or_manifest [n_threads] [path/to/log_directory]\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    const auto default_n_threads = static_cast<int>(std::max(1U, std::thread::hardware_concurrency()));
+    const auto n_threads = (argc >= 3) ? std::stoi(argv[2]) : default_n_threads;
+    if (n_threads <= 0) {
+        std::cerr << "ERROR: the number of threads must be positive.\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    auto options = elec::BatchOptions {};
+    options.n_threads = static_cast<std::size_t>(n_threads);
+    if (argc == 4) {
+        options.log_directory = std::filesystem::path {argv[3]};
+    }
+
+    try {
+        const auto input_paths = elec::batch_input_files(std::filesystem::path {argv[1]});
+        const auto results = elec::run_batch(input_paths, options, std::cout);
+
+        const auto n_failed = std::count_if(
+            results.begin(),
+            results.end(),
+            [](const auto& result) { return result.status == elec::BatchJobStatus::FAILED; }
+        );
+
+        std::cerr << "Finished " << results.size() << " jobs; " << n_failed << " failed\n";
+    }
+    catch (const std::exception& error) {
+        std::cerr << "ERROR: " << error.what() << '\n';
+        std::exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
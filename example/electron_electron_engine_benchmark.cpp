@@ -0,0 +1,94 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <elecstruct/elecstruct.hpp>
+#include <elecstruct/integrals/shell_pair_data.hpp>
+#include <elecstruct/integrals/two_electron_integral_grid.hpp>
+#include <elecstruct/matrices.hpp>
+
+/*
+    Times how long each of the two-electron integral engines takes to calculate the full grid of
+    integrals for the molecule in the input toml file, and how far each one strays from the
+    integrals of the original (Cook) engine.
+*/
+
+struct EngineInfo
+{
+    std::string name;
+    elec::ElectronElectronEngine engine;
+};
+
+auto main(int argc, const char** argv) -> int
+{
+    if (argc < 2 || argc > 3) {
+        std::cerr << "./a.out path/to/input.toml [n_repetitions]\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    const auto path = std::filesystem::path {argv[1]};
+    auto toml_stream = std::ifstream {path};
+    if (!toml_stream.is_open()) {
+        std::cerr << "ERROR: failed to open the input toml file.\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    const auto n_repetitions = (argc == 3) ? std::stoi(argv[2]) : 5;
+    if (n_repetitions <= 0) {
+        std::cerr << "ERROR: the number of repetitions must be positive.\n";
+        std::exit(EXIT_FAILURE);
+    }
+
+    auto parser = elec::InputFileParser {toml_stream};
+    parser.parse(elec::InputFileKey::ATOM_INFORMATION);
+
+    auto atoms = parser.parsed_information().atom_information();
+    elec::fill_atomic_orbitals_sto3g(atoms);
+
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+
+    using EEE = elec::ElectronElectronEngine;
+    const auto engines = std::vector<EngineInfo> {
+        {"cook",              EEE::COOK             },
+        {"head_gordon_pople", EEE::HEAD_GORDON_POPLE},
+        {"rys",               EEE::RYS              },
+        {"specialized",       EEE::SPECIALIZED      }
+    };
+
+    const auto reference = elec::two_electron_integral_grid(shell_pairs, EEE::COOK);
+
+    std::cout << "Basis size: " << basis.size() << '\n';
+    std::cout << "Repetitions: " << n_repetitions << "\n\n";
+
+    for (const auto& [name, engine] : engines) {
+        auto grid = elec::TwoElectronIntegralGrid {};
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i {0}; i < n_repetitions; ++i) {
+            grid = elec::two_electron_integral_grid(shell_pairs, engine);
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const auto elapsed = std::chrono::duration<double, std::milli> {end - start}.count() / n_repetitions;
+
+        auto max_difference = double {0.0};
+        const auto values = grid.values();
+        const auto reference_values = reference.values();
+        for (std::size_t i {0}; i < values.size(); ++i) {
+            max_difference = std::max(max_difference, std::fabs(values[i] - reference_values[i]));
+        }
+
+        std::cout << std::left << std::setw(20) << name;
+        std::cout << std::fixed << std::setprecision(3) << std::setw(12) << elapsed << " ms";
+        std::cout << "    max |difference| = " << std::scientific << std::setprecision(3) << max_difference << '\n';
+    }
+
+    return 0;
+}
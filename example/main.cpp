@@ -28,13 +28,9 @@ auto main(int argc, const char** argv) -> int
     elec::fill_atomic_orbitals_sto3g(atoms);
 
     const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
-    const auto initial_fock = info.initial_fock_guess();
-    const auto n_electrons = info.n_electrons();
-    const auto max_iter = info.max_hartree_fock_iterations();
-    const auto tolerance = info.tol_change_density_matrix();
-    const auto verbose = info.verbose();
+    const auto options = elec::restricted_hartree_fock_options(info);
 
-    elec::perform_restricted_hartree_fock(atoms, basis, initial_fock, n_electrons, max_iter, tolerance, verbose);
+    elec::perform_restricted_hartree_fock(atoms, basis, options);
 
     return 0;
 }
@@ -33,14 +33,15 @@ auto main() -> int
     };
 
     const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
-    const auto initial_fock = elec::InitialFockGuess::ZERO_MATRIX;
-
-    const auto n_electrons = std::size_t {10};
-    const auto n_max_iter = std::size_t {100};
-    const auto tolerance = double {1.0e-8};
-    const auto verbose = elec::Verbose::TRUE;
+    const auto options = elec::RestrictedHartreeFockOptions {
+        .initial_fock = elec::InitialFockGuess::ZERO_MATRIX,
+        .n_electrons = std::size_t {10},
+        .n_max_iter = std::size_t {100},
+        .tolerance_change_density_matrix = double {1.0e-8},
+        .is_verbose = elec::Verbose::TRUE
+    };
 
-    elec::perform_restricted_hartree_fock(atoms, basis, initial_fock, n_electrons, n_max_iter, tolerance, verbose);
+    elec::perform_restricted_hartree_fock(atoms, basis, options);
 
     return 0;
 }
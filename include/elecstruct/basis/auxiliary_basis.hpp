@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "elecstruct/basis/basis_sets/sto3g.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/orbitals.hpp"
+
+namespace elec
+{
+
+/*
+    A single normalized primitive cartesian gaussian, used to expand the products of the orbitals of
+    the basis in a density fitting calculation.
+*/
+struct AuxiliaryFunctionInfo
+{
+    coord::Cartesian3D position;
+    AngularMomentumNumbers angular_momentum;
+    double exponent;
+};
+
+/*
+    The ratio between consecutive exponents of an even-tempered auxiliary basis.
+*/
+constexpr auto DEFAULT_EVEN_TEMPERED_RATIO = double {2.5};
+
+/*
+    Creates an even-tempered auxiliary basis for the orbitals in `basis`.
+
+    The orbitals are grouped by their centres. A product of two gaussians on the same centre has an
+    exponent between twice the smallest and twice the largest exponent on that centre, and an angular
+    momentum up to twice the largest angular momentum on that centre. Each centre receives the
+    exponents
+
+        alpha_k = 2 alpha_min ratio^k,    k = 0, 1, ..., n - 1
+
+    where `n` is the smallest number needed to reach 2 alpha_max, with every cartesian component of
+    every angular momentum in that range.
+*/
+auto create_even_tempered_auxiliary_basis(
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    double ratio = DEFAULT_EVEN_TEMPERED_RATIO
+) -> std::vector<AuxiliaryFunctionInfo>;
+
+}  // namespace elec
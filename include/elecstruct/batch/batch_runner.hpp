@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/input_file_parser/parsed_information.hpp"
+#include "elecstruct/restricted_hartree_fock/restricted_hartree_fock.hpp"
+
+/*
+    Runs many independent restricted Hartree-Fock calculations, each described by its own toml input
+    file, within a single process.
+
+    The jobs are spread across a pool of threads; each job runs on a single thread by default, since
+    running many small calculations side by side makes better use of the cores than running each of
+    them in parallel one after the other. The progress output of each job goes to its own log file (or
+    nowhere), so that the output of jobs running at the same time never gets interleaved.
+*/
+
+namespace elec
+{
+
+/*
+    The settings of a restricted Hartree-Fock calculation, as described by a parsed input file.
+*/
+auto restricted_hartree_fock_options(const ParsedInformation& info) -> RestrictedHartreeFockOptions;
+
+/*
+    The input files of a batch, given either as a directory (every '.toml' file directly inside it,
+    in alphabetical order), or as a manifest file with one path per line. Relative paths in a manifest
+    are relative to the directory the manifest is in; blank lines, and lines that start with '#', are
+    skipped.
+*/
+auto batch_input_files(const std::filesystem::path& directory_or_manifest) -> std::vector<std::filesystem::path>;
+
+struct BatchOptions
+{
+    // the number of jobs that run at the same time
+    std::size_t n_threads {DEFAULT_N_THREADS};
+
+    // replaces the number of threads given in each input file
+    std::size_t n_threads_per_job {1};
+
+    // if given, the progress of each job is written to '<log_directory>/<job index>_<input file stem>.log';
+    // the index of the job in the batch keeps the names unique, even for input files with the same stem
+    std::optional<std::filesystem::path> log_directory {};
+};
+
+enum class BatchJobStatus
+{
+    CONVERGED,
+    NOT_CONVERGED,
+    FAILED
+};
+
+struct BatchJobResult
+{
+    std::filesystem::path input_path;
+    BatchJobStatus status;
+    std::size_t n_iterations;
+    double total_energy;
+    double seconds;  // the time taken by the calculation, or by the input file of a job that failed to prepare
+    std::string error_message;  // empty unless the job failed
+};
+
+/*
+    The single line that describes the result of a job; the fields are separated by tabs:
+
+        <input path>  <converged|not_converged|failed>  <total energy>  <iterations>  <seconds>  [<error>]
+*/
+auto format_batch_job_result(const BatchJobResult& result) -> std::string;
+
+/*
+    Runs every job in the batch, and writes one result line to `results_output` as each job finishes.
+    A job that fails (because its input file is invalid, for example) is reported as failed, and does
+    not stop the other jobs. The results are returned in the same order as `input_paths`.
+*/
+auto run_batch(
+    const std::vector<std::filesystem::path>& input_paths,
+    const BatchOptions& options,
+    std::ostream& results_output
+) -> std::vector<BatchJobResult>;
+
+}  // namespace elec
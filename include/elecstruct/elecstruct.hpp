@@ -2,6 +2,7 @@
 
 #include "elecstruct/atoms.hpp"
 #include "elecstruct/basis/basis.hpp"
+#include "elecstruct/batch/batch_runner.hpp"
 #include "elecstruct/cartesian3d.hpp"
 #include "elecstruct/geometry.hpp"
 #include "elecstruct/input_file_parser/input_file_parser.hpp"
@@ -1,18 +1,26 @@
 #pragma once
 
+#include <cstddef>
+
 /*
     This header file contains the enum classes for various options that the InputFileParser
-    object can accommodate.
+    object can accommodate, as well as the default values for the options that are optional.
 */
 
 namespace elec
 {
 
+/*
+    The starting point of the self-consistent field iterations. SUPERPOSITION_OF_ATOMIC_DENSITIES
+    guesses the density matrix directly, from calculations on the isolated atoms; the others guess the
+    Fock matrix, and the initial density matrix comes from diagonalizing it.
+*/
 enum class InitialFockGuess
 {
     ZERO_MATRIX,
     EXTENDED_HUCKEL_MATRIX,
-    CORE_HAMILTONIAN_MATRIX
+    CORE_HAMILTONIAN_MATRIX,
+    SUPERPOSITION_OF_ATOMIC_DENSITIES
 };
 
 enum class Verbose
@@ -21,4 +29,88 @@ enum class Verbose
     FALSE
 };
 
+/*
+    The method used to calculate the two-electron integrals; they give the same integrals, up to
+    floating-point roundoff.
+      - COOK: the explicit expansion in B-factors, from Cook's Handbook of Computational Quantum Chemistry
+      - HEAD_GORDON_POPLE: the Obara-Saika vertical and Head-Gordon-Pople horizontal recurrence relations
+      - RYS: Rys quadrature, with the roots and weights calculated from the Boys function
+      - SPECIALIZED: Obara-Saika kernels unrolled at compile time for each angular momentum class
+*/
+enum class ElectronElectronEngine
+{
+    COOK,
+    HEAD_GORDON_POPLE,
+    RYS,
+    SPECIALIZED
+};
+
+/*
+    How the two-electron integrals are handled during the self-consistent field iterations.
+      - CONVENTIONAL: every integral is calculated once, and stored in memory before the iterations start
+      - DIRECT: the integrals are recalculated during every iteration, and never stored
+      - OUT_OF_CORE: every integral is calculated once, and written to a file on disk; the file is
+        streamed back through memory during every iteration
+      - DENSITY_FITTING: the four-centre integrals are approximated with three-centre integrals over
+        an even-tempered auxiliary basis, which are calculated once and stored in memory
+      - CHOLESKY: the four-centre integrals are approximated by an incomplete pivoted Cholesky
+        decomposition, whose vectors are calculated once and stored in memory
+*/
+enum class ScfMode
+{
+    CONVENTIONAL,
+    DIRECT,
+    OUT_OF_CORE,
+    DENSITY_FITTING,
+    CHOLESKY
+};
+
+/*
+    Two-electron integrals whose Schwarz upper bound falls below this value are not calculated.
+*/
+constexpr auto DEFAULT_SCHWARZ_SCREENING_TOLERANCE = double {1.0e-12};
+
+/*
+    The number of threads used to calculate the two-electron integrals.
+*/
+constexpr auto DEFAULT_N_THREADS = std::size_t {1};
+
+constexpr auto DEFAULT_ELECTRON_ELECTRON_ENGINE = ElectronElectronEngine::SPECIALIZED;
+
+constexpr auto DEFAULT_SCF_MODE = ScfMode::CONVENTIONAL;
+
+/*
+    In a direct SCF calculation, the two-electron part of the Fock matrix is built up incrementally
+    from the change in the density matrix; it is rebuilt from the full density matrix once every
+    this many iterations, so that roundoff and screening errors cannot accumulate.
+*/
+constexpr auto DEFAULT_DIRECT_SCF_FULL_REBUILD_PERIOD = std::size_t {8};
+
+/*
+    The Cholesky decomposition of the two-electron integrals stops once every remaining diagonal
+    element falls below this value, which also bounds the error in every integral.
+*/
+constexpr auto DEFAULT_CHOLESKY_THRESHOLD = double {1.0e-6};
+
+/*
+    DIIS extrapolation of the Fock matrix starts at this iteration; the Fock matrices of the earlier
+    iterations are still stored, so that the first extrapolation has a history to work with. Starting
+    later can help when the initial guess is poor, and the first few Fock matrices are far from
+    convergence.
+*/
+constexpr auto DEFAULT_DIIS_START_ITERATION = std::size_t {1};
+
+/*
+    The number of the most recent Fock matrices that DIIS extrapolates from; a history length of
+    zero turns DIIS off, and the density matrix is calculated from the most recent Fock matrix.
+*/
+constexpr auto DEFAULT_DIIS_HISTORY_LENGTH = std::size_t {8};
+
+/*
+    If a checkpoint file is given, it is rewritten once every this many iterations, and once more when
+    the calculation converges. Every checkpoint rewrites the whole file, including the two-electron
+    integrals of a conventional calculation.
+*/
+constexpr auto DEFAULT_CHECKPOINT_PERIOD = std::size_t {5};
+
 }  // namespace elec
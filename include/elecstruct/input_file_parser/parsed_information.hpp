@@ -1,6 +1,8 @@
 #pragma once
 
 #include <any>
+#include <filesystem>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -18,7 +20,17 @@ enum class InputFileKey
     TOL_CHANGE_DENSITY_MATRIX,
     TOL_CHANGE_HARTREE_FOCK_ENERGY,
     N_ELECTRONS,
-    VERBOSE
+    VERBOSE,
+    SCHWARZ_SCREENING_TOLERANCE,
+    N_THREADS,
+    ELECTRON_ELECTRON_ENGINE,
+    SCF_MODE,
+    CHOLESKY_THRESHOLD,
+    DIIS_START_ITERATION,
+    DIIS_HISTORY_LENGTH,
+    CHECKPOINT_FILE,
+    CHECKPOINT_PERIOD,
+    RESTART_FROM_CHECKPOINT
 };
 
 class ParsedInformation
@@ -32,6 +44,16 @@ public:
     auto tol_change_hartree_fock_energy() const -> double;
     auto n_electrons() const -> std::size_t;
     auto verbose() const -> Verbose;
+    auto schwarz_screening_tolerance() const -> double;
+    auto n_threads() const -> std::size_t;
+    auto electron_electron_engine() const -> ElectronElectronEngine;
+    auto scf_mode() const -> ScfMode;
+    auto cholesky_threshold() const -> double;
+    auto diis_start_iteration() const -> std::size_t;
+    auto diis_history_length() const -> std::size_t;
+    auto checkpoint_file() const -> std::optional<std::filesystem::path>;
+    auto checkpoint_period() const -> std::size_t;
+    auto restart_from_checkpoint() const -> bool;
 
 private:
     std::unordered_map<InputFileKey, std::any> info_ {};
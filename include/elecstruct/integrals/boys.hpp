@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <span>
+
 /*
     A reproduction of the iemplementation of the fast Boys algorithm provided in
 
@@ -12,6 +15,21 @@
 namespace elec
 {
 
+/*
+    The highest order of the Boys function that the implementation supports.
+*/
+constexpr auto BOYS_MAX_ORDER = std::size_t {12};
+
 auto boys_beylkin_sharma(double x, std::size_t n) -> double;
 
+/*
+    Fill `values[0]` through `values[n_max]` with the Boys functions F_0(x) through F_n_max(x).
+
+    Both branches of the algorithm produce every order along the way (through upward recursion
+    for large `x`, and downward recursion for small `x`), so getting all of them at once costs
+    the same as getting just one. The integral kernels need many orders at the same argument,
+    and should call this once instead of calling `boys_beylkin_sharma()` for each order.
+*/
+void boys_all_orders(double x, std::size_t n_max, std::span<double> values);
+
 }  // namespace elec
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+/*
+    An alternative implementation of the Boys function, based on a precomputed grid.
+
+    For arguments below `BOYS_TABULATED_LARGE_CUTOFF`, the Boys function of order n is found from a
+    Taylor expansion about the nearest grid point x_i,
+
+        F_n(x_i + d) = sum_k F_{n+k}(x_i) (-d)^k / k!
+
+    which only needs multiplications and additions, since the derivative of F_n is -F_{n+1}. For
+    larger arguments, F_0 takes its asymptotic form sqrt(pi / x) / 2, and the higher orders follow
+    from upward recursion.
+
+    The grid holds the Boys functions up to the highest order needed by the Taylor expansion, and
+    is built once, the first time any of these functions are called.
+*/
+
+namespace elec
+{
+
+/*
+    The argument above which the asymptotic form is used instead of the grid.
+*/
+constexpr auto BOYS_TABULATED_LARGE_CUTOFF = double {30.0};
+
+auto boys_tabulated(double x, std::size_t n) -> double;
+
+/*
+    Fill `values[0]` through `values[n_max]` with the Boys functions F_0(x) through F_n_max(x); this
+    is the tabulated counterpart of `boys_all_orders()`.
+*/
+void boys_all_orders_tabulated(double x, std::size_t n_max, std::span<double> values);
+
+/*
+    Fill `values[i]` with the Boys function of order `n` at the argument `xs[i]`.
+
+    The arguments below the cutoff all go through the same branch-free loop over the grid, which
+    the compiler is free to vectorize; the few arguments above the cutoff are handled afterwards.
+*/
+void boys_tabulated_batch(std::span<const double> xs, std::size_t n, std::span<double> values);
+
+}  // namespace elec
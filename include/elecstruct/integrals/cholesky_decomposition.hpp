@@ -0,0 +1,39 @@
+#pragma once
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+/*
+    The incomplete pivoted Cholesky decomposition of the two-electron integrals, treated as the
+    positive semidefinite matrix V((i0 i1), (i2 i3)) = (i0 i1|i2 i3) over the unique index pairs.
+
+    Each step picks the pair p with the largest remaining diagonal element d(p), calculates the single
+    column (r|p) of integrals, and turns it into a new Cholesky vector
+
+        L_J(r) = [(r|p) - sum_{K < J} L_K(r) L_K(p)] / sqrt(d(p))
+
+    after which d(r) -= L_J(r)^2 for every pair r. The decomposition stops once every remaining
+    diagonal element falls below the threshold; since V is positive semidefinite, the error in every
+    integral is then bounded by
+
+        |(r|s) - sum_J L_J(r) L_J(s)| <= sqrt(d(r) d(s)) < threshold
+
+    Only the diagonal and the pivot columns are ever calculated, and the number of vectors grows only
+    as fast as the numerical rank of V, which is far smaller than the number of pairs.
+*/
+
+namespace elec
+{
+
+/*
+    Decomposes the two-electron integrals, until every remaining diagonal element falls below
+    `threshold`; the Cholesky vectors are the factors of the returned integrals.
+*/
+auto cholesky_decomposed_integrals(
+    const ShellPairData& shell_pairs,
+    double threshold = DEFAULT_CHOLESKY_THRESHOLD,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> FactorizedTwoElectronIntegrals;
+
+}  // namespace elec
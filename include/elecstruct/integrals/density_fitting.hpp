@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "elecstruct/basis/auxiliary_basis.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+/*
+    The resolution-of-the-identity (density fitting) approximation to the two-electron integrals,
+
+        (i0 i1|i2 i3) ~= sum_{P, Q} (i0 i1|P) [V^-1](P, Q) (Q|i2 i3),    V(P, Q) = (P|Q)
+
+    where P and Q run over the functions of an auxiliary basis. With the Cholesky factorization
+    V = L L^T, the fitted three-centre integrals
+
+        B_P(i0, i1) = sum_Q [L^-1](P, Q) (Q|i0 i1)
+
+    give (i0 i1|i2 i3) ~= sum_P B_P(i0, i1) B_P(i2, i3).
+*/
+
+namespace elec
+{
+
+/*
+    Calculates the three-centre and two-centre integrals, and fits the three-centre integrals; the
+    fitted integrals B_P are the factors of the returned integrals.
+
+    Throws if the metric V is not positive definite, which happens when the auxiliary basis is too
+    close to being linearly dependent.
+*/
+auto density_fitted_integrals(
+    const ShellPairData& shell_pairs,
+    const std::vector<AuxiliaryFunctionInfo>& aux_basis,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> FactorizedTwoElectronIntegrals;
+
+}  // namespace elec
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "elecstruct/basis/basis.hpp"
 #include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/orbitals.hpp"
 
 namespace elec
@@ -21,4 +24,25 @@ auto electron_electron_integral_contraction(
     double exponent3
 ) -> double;
 
+/*
+    Calculates the two-electron integral (01|23) between the contracted orbitals of the bra pair (01)
+    and the ket pair (23).
+*/
+auto electron_electron_integral(const ShellPair& bra, const ShellPair& ket) -> double;
+
+/*
+    Calculates the two-electron integral (01|23) using the chosen engine.
+*/
+auto electron_electron_integral(const ShellPair& bra, const ShellPair& ket, ElectronElectronEngine engine) -> double;
+
+/*
+    Calculates the two-electron integral (01|23) between four contracted atomic orbitals.
+*/
+auto electron_electron_integral(
+    const AtomicOrbitalInfoSTO3G& orbital0,
+    const AtomicOrbitalInfoSTO3G& orbital1,
+    const AtomicOrbitalInfoSTO3G& orbital2,
+    const AtomicOrbitalInfoSTO3G& orbital3
+) -> double;
+
 }  // namespace elec
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+
+#include <Eigen/Dense>
+
+namespace elec
+{
+
+/*
+    The two-electron integrals in a factorized form,
+
+        (i0 i1|i2 i3) ~= sum_J L_J(i0, i1) L_J(i2, i3)
+
+    where each L_J is a symmetric N x N matrix. Both density fitting and the Cholesky decomposition of
+    the two-electron integrals produce this form, with the fitted three-centre integrals and the
+    Cholesky vectors as the L_J, respectively.
+
+    The Coulomb and exchange matrices become
+
+        J = sum_J L_J tr(L_J D)
+        K = sum_J L_J D L_J
+
+    which are assembled entirely from dense matrix products. Only the N^2 M elements of the M matrices
+    L_J are stored, instead of the N^4 / 8 unique four-centre integrals.
+*/
+class FactorizedTwoElectronIntegrals
+{
+public:
+    /*
+        The `vectors` are an N x (N M) matrix, where the J-th block of N columns holds L_J.
+    */
+    FactorizedTwoElectronIntegrals(std::size_t n_basis_functions, Eigen::MatrixXd vectors);
+
+    auto coulomb_matrix(const Eigen::MatrixXd& density_mtx) const -> Eigen::MatrixXd;
+    auto exchange_matrix(const Eigen::MatrixXd& density_mtx) const -> Eigen::MatrixXd;
+
+    /*
+        The in-place versions of `coulomb_matrix()` and `exchange_matrix()`, which write into a matrix that
+        already has the size of the basis. The intermediates of the contraction, tr(L_J D) and the blocks
+        D L_J, are still allocated on every call.
+    */
+    void coulomb_matrix(Eigen::MatrixXd& coulomb_mtx, const Eigen::MatrixXd& density_mtx) const;
+    void exchange_matrix(Eigen::MatrixXd& exchange_mtx, const Eigen::MatrixXd& density_mtx) const;
+
+    /*
+        The matrices L_J, side by side; meant for methods that consume the factorized integrals
+        directly, instead of through the Coulomb and exchange matrices.
+    */
+    auto vectors() const noexcept -> const Eigen::MatrixXd&;
+
+    auto n_basis_functions() const noexcept -> std::size_t;
+    auto n_vectors() const noexcept -> std::size_t;
+
+private:
+    std::size_t n_basis_functions_;
+    std::size_t n_vectors_;
+    Eigen::MatrixXd vectors_;
+
+    void check_density_matrix_(const Eigen::MatrixXd& density_mtx) const;
+    void check_output_matrix_(const Eigen::MatrixXd& output_mtx) const;
+};
+
+}  // namespace elec
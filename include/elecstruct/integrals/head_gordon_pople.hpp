@@ -0,0 +1,37 @@
+#pragma once
+
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+/*
+    An implementation of the two-electron integrals using the recurrence relations of
+
+    title: "Efficient recursive computation of molecular integrals over Cartesian Gaussian functions"
+    authors: S. Obara and A. Saika
+    journal: J. Chem. Phys. 84, 3963 (1986)
+    link: https://doi.org/10.1063/1.450106
+
+    and
+
+    title: "A method for two-electron Gaussian integral and integral derivative evaluation using
+            recurrence relations"
+    authors: M. Head-Gordon and J. A. Pople
+    journal: J. Chem. Phys. 89, 5777 (1988)
+    link: https://doi.org/10.1063/1.455553
+
+    The vertical recurrence relation (VRR) of Obara and Saika builds up the integrals [e0|f0] for
+    each primitive quartet, where all the angular momentum sits on the first centre of each pair.
+    These are contracted, and the horizontal recurrence relation (HRR) of Head-Gordon and Pople then
+    moves the angular momentum over to the second centres; because the HRR does not depend on the
+    exponents, it only has to be applied once per contracted quartet, rather than once per primitive.
+*/
+
+namespace elec
+{
+
+/*
+    Calculates the two-electron integral (01|23) between the contracted orbitals of the bra pair (01)
+    and the ket pair (23).
+*/
+auto electron_electron_integral_head_gordon_pople(const ShellPair& bra, const ShellPair& ket) -> double;
+
+}  // namespace elec
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 
 #include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/integrals/overlap_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/orbitals.hpp"
 
 namespace elec
@@ -88,4 +91,20 @@ auto kinetic_integral_contraction(
     double exponent1
 ) -> double;
 
+/*
+    The kinetic integral between the two contracted orbitals of the shell pair.
+*/
+auto kinetic_integral(const ShellPair& pair) -> double;
+
+/*
+    The kinetic integral of a single primitive pair, without the contraction coefficients and
+    normalization constants, from its 1D overlap integrals; every 1D overlap integral is only
+    calculated once, instead of once for each axis of the kinetic integral that needs it.
+*/
+auto primitive_kinetic_integral(
+    const ShellPair& pair,
+    const PrimitivePairData& primitive,
+    const OverlapIntegrals3D& overlaps_1d
+) -> double;
+
 }  // namespace elec
@@ -1,11 +1,27 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
+#include "elecstruct/atoms.hpp"
 #include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/orbitals.hpp"
 
 namespace elec
 {
 
+/*
+    A nucleus, as the electrons see it.
+*/
+struct PointCharge
+{
+    coord::Cartesian3D position;
+    double charge;
+};
+
+auto point_charges(const std::vector<AtomInfo>& atoms) -> std::vector<PointCharge>;
+
 auto nuclear_electron_integral_contraction(
     const AngularMomentumNumbers& angmom_0,
     const AngularMomentumNumbers& angmom_1,
@@ -17,4 +33,28 @@ auto nuclear_electron_integral_contraction(
     double nuclear_charge
 ) -> double;
 
+/*
+    The attraction integral between the two contracted orbitals of the shell pair and a nucleus
+    with charge `nuclear_charge` at `pos_nuclear`.
+*/
+auto nuclear_electron_integral(const ShellPair& pair, const coord::Cartesian3D& pos_nuclear, double nuclear_charge)
+    -> double;
+
+/*
+    The sum of the attraction integrals between the two contracted orbitals of the shell pair and
+    each of the nuclei.
+*/
+auto nuclear_electron_integral(const ShellPair& pair, std::span<const PointCharge> nuclei) -> double;
+
+/*
+    The same sum for a single primitive pair, without the contraction coefficients and normalization
+    constants. The parts of the integral that only depend on the primitive pair are calculated once,
+    and shared by every nucleus.
+*/
+auto primitive_nuclear_electron_integral(
+    const ShellPair& pair,
+    const PrimitivePairData& primitive,
+    std::span<const PointCharge> nuclei
+) -> double;
+
 }  // namespace elec
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <span>
+
+#include "elecstruct/integrals/nuclear_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+namespace elec
+{
+
+struct OneElectronIntegrals
+{
+    double overlap;
+    double kinetic;
+    double nuclear_electron;  // summed over every nucleus
+};
+
+/*
+    The overlap, kinetic, and nuclear-electron integrals between the two contracted orbitals of the
+    shell pair, calculated together in a single pass over its primitive pairs.
+
+    The 1D overlap integrals of each primitive pair are calculated once, and shared by the overlap
+    and kinetic integrals; the parts of the nuclear-electron integrals that do not depend on the
+    nucleus are calculated once, and shared by every nucleus.
+*/
+auto one_electron_integrals(const ShellPair& pair, std::span<const PointCharge> nuclei) -> OneElectronIntegrals;
+
+}  // namespace elec
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 #include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/orbitals.hpp"
 
 namespace elec
@@ -30,4 +34,50 @@ auto overlap_integral_contraction(
     double exponent1
 ) -> double;
 
+/*
+    The overlap integral between the two contracted orbitals of the shell pair.
+*/
+auto overlap_integral(const ShellPair& pair) -> double;
+
+/*
+    The unnormalized 1D overlap integrals of a primitive pair along a single axis, for the angular
+    momenta (a, b) of the pair along that axis, and for the angular momenta shifted by one; these are
+    all the 1D overlap integrals that the overlap and kinetic integrals of the pair need.
+*/
+struct OverlapIntegrals1D
+{
+    double same;           // (a, b)
+    double lower_lower;    // (a - 1, b - 1)
+    double raised_lower;   // (a + 1, b - 1)
+    double lower_raised;   // (a - 1, b + 1)
+    double raised_raised;  // (a + 1, b + 1)
+};
+
+/*
+    The 1D overlap integrals of a primitive pair along the x, y, and z axes.
+*/
+using OverlapIntegrals3D = std::array<OverlapIntegrals1D, 3>;
+
+/*
+    The 1D overlap integrals along a single axis, for the angular momenta, positions, and exponents of
+    the two primitives along that axis, and the position of their product centre along that axis.
+*/
+auto overlap_integrals_along_axis(
+    std::int64_t angmom0,
+    std::int64_t angmom1,
+    double position0,
+    double position1,
+    double product_centre,
+    double exponent0,
+    double exponent1
+) -> OverlapIntegrals1D;
+
+auto overlap_integrals_1d(const ShellPair& pair, const PrimitivePairData& primitive) -> OverlapIntegrals3D;
+
+/*
+    The overlap integral of a single primitive pair, without the contraction coefficients and
+    normalization constants, from its 1D overlap integrals.
+*/
+auto primitive_overlap_integral(const PrimitivePairData& primitive, const OverlapIntegrals3D& overlaps_1d) -> double;
+
 }  // namespace elec
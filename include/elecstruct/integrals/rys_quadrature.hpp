@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+/*
+    An implementation of the two-electron integrals using Rys quadrature, following
+
+    title: "Evaluation of molecular integrals over Gaussian basis functions"
+    authors: M. Dupuis, J. Rys, and H. F. King
+    journal: J. Chem. Phys. 65, 111 (1976)
+    link: https://doi.org/10.1063/1.432807
+
+    The Boys function part of each primitive integral is replaced by an exact Gaussian quadrature
+    over the Rys polynomials, after which the integral factors into a product of 2D integrals in x,
+    y, and z at each quadrature point. An integral with total angular momentum L needs
+    floor(L / 2) + 1 quadrature points.
+
+    Rather than relying on fitted tables for the roots and weights, they are found directly from
+    the moments of the Rys weight function, which are the Boys functions F_0(x), ..., F_{2n-1}(x).
+*/
+
+namespace elec
+{
+
+/*
+    The Boys function implementation goes up to order 12, which limits the number of points to 6,
+    and the total angular momentum of a quartet to 10.
+*/
+constexpr auto RYS_MAX_N_ROOTS = std::size_t {6};
+
+/*
+    The roots are given in terms of u = t^2, where t is the usual variable of the Rys polynomials;
+    the quadrature is exact for polynomials in u up to degree 2n - 1, so that
+
+        F_k(x) = sum_i weights[i] * roots[i]^k,    for k = 0, ..., 2n - 1
+*/
+struct RysQuadrature
+{
+    std::size_t n_roots;
+    std::array<double, RYS_MAX_N_ROOTS> roots;
+    std::array<double, RYS_MAX_N_ROOTS> weights;
+};
+
+auto rys_quadrature(double x, std::size_t n_roots) -> RysQuadrature;
+
+/*
+    Calculates the two-electron integral (01|23) between the contracted orbitals of the bra pair (01)
+    and the ket pair (23).
+*/
+auto electron_electron_integral_rys(const ShellPair& bra, const ShellPair& ket) -> double;
+
+}  // namespace elec
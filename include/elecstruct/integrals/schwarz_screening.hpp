@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+namespace elec
+{
+
+/*
+    The Cauchy-Schwarz inequality gives an upper bound for the magnitude of each two-electron integral,
+
+        |(01|23)| <= sqrt((01|01)) * sqrt((23|23))
+
+    and so only the "diagonal" integrals (01|01), one per pair of basis functions, are needed to
+    find the quartets whose integrals are too small to matter. This lets us skip those quartets
+    entirely, rather than paying for all of the primitive contractions to find a tiny result.
+*/
+class SchwarzScreening
+{
+public:
+    /*
+        Calculates the diagonal integrals for every pair of basis functions; any quartet whose bound
+        falls below `tolerance` is considered negligible. A tolerance of 0.0 disables the screening.
+    */
+    SchwarzScreening(const std::vector<AtomicOrbitalInfoSTO3G>& basis, double tolerance);
+    SchwarzScreening(const ShellPairData& shell_pairs, double tolerance);
+
+    /*
+        The value of sqrt(|(01|01)|) for the pair of basis functions `i0` and `i1`.
+    */
+    auto pair_bound(std::size_t i0, std::size_t i1) const noexcept -> double;
+
+    /*
+        The upper bound sqrt(|(01|01)|) * sqrt(|(23|23)|) on the magnitude of (01|23).
+    */
+    auto bound(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept -> double;
+
+    auto is_negligible(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept -> bool;
+
+    auto tolerance() const noexcept -> double;
+
+private:
+    double tolerance_;
+    std::vector<double> pair_bounds_;
+};
+
+}  // namespace elec
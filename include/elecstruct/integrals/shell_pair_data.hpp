@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "elecstruct/basis/auxiliary_basis.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/orbitals.hpp"
+
+namespace elec
+{
+
+/*
+    The quantities of a product of two primitive gaussians that only depend on the two gaussians
+    themselves; every integral kernel needs them, so they are calculated once per pair instead of
+    once per integral.
+*/
+struct PrimitivePairData
+{
+    double exponent0;
+    double exponent1;
+
+    // the exponent of the product gaussian, a + b
+    double exponent_sum;
+
+    // the centre of the product gaussian, (a A + b B) / (a + b)
+    coord::Cartesian3D product_centre;
+
+    // the coefficient of the product gaussian, exp(-ab / (a + b) |A - B|^2)
+    double prefactor;
+
+    // the contraction coefficients and the normalization constants of both gaussians, multiplied together
+    double coefficient;
+};
+
+auto make_primitive_pair_data(
+    const AngularMomentumNumbers& angmom0,
+    const AngularMomentumNumbers& angmom1,
+    const coord::Cartesian3D& position0,
+    const coord::Cartesian3D& position1,
+    const GaussianContractionInfo& gaussian0,
+    const GaussianContractionInfo& gaussian1
+) -> PrimitivePairData;
+
+/*
+    All the primitive pairs formed by two contracted atomic orbitals.
+*/
+struct ShellPair
+{
+    AngularMomentumNumbers angmom0;
+    AngularMomentumNumbers angmom1;
+    coord::Cartesian3D position0;
+    coord::Cartesian3D position1;
+    std::vector<PrimitivePairData> primitives;
+};
+
+auto make_shell_pair(const AtomicOrbitalInfoSTO3G& orbital0, const AtomicOrbitalInfoSTO3G& orbital1) -> ShellPair;
+
+/*
+    The "pair" formed by an auxiliary function and the constant function 1, which is an s-type
+    gaussian with an exponent of zero. Passing it to the two-electron integral kernels gives the
+    three-centre integrals (P|i0 i1) and the two-centre integrals (P|Q) of density fitting.
+*/
+auto make_auxiliary_shell_pair(const AuxiliaryFunctionInfo& function) -> ShellPair;
+
+/*
+    The shell pairs for every unordered pair of orbitals in a basis, stored in the same compound
+    index order as the first stage of the Yoshimine sort.
+
+    Only the pairs (i0, i1) with i0 >= i1 are stored; asking for (i0, i1) with i0 < i1 gives the
+    pair (i1, i0), which is fine for every integral that is symmetric in the two orbitals.
+*/
+class ShellPairData
+{
+public:
+    explicit ShellPairData(const std::vector<AtomicOrbitalInfoSTO3G>& basis);
+
+    auto get(std::size_t i0, std::size_t i1) const noexcept -> const ShellPair&;
+
+    auto n_basis_functions() const noexcept -> std::size_t;
+
+private:
+    std::size_t n_basis_functions_;
+    std::vector<ShellPair> pairs_;
+};
+
+}  // namespace elec
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+/*
+    Two-electron integral kernels that are specialized at compile time on the angular momentum class
+    (l0 l1|l2 l3) of the quartet.
+
+    Each kernel applies the Obara-Saika recurrence relation to the full four-centre integral, with
+    the angular momentum of every centre and the auxiliary index known at compile time; the whole
+    recursion tree is unrolled into straight-line code, and the only decisions left at runtime are
+    which Cartesian direction each p-orbital points in. The number of Boys function orders needed
+    by each class is also known at compile time.
+
+    A table, indexed by the angular momentum class, picks the kernel for each quartet. Quartets
+    with an orbital whose angular momentum is above `SPECIALIZED_MAX_ANGULAR_MOMENTUM` fall back to
+    the Head-Gordon-Pople engine.
+*/
+
+namespace elec
+{
+
+/*
+    The basis sets currently only go up to p-orbitals, so only the s- and p-classes are specialized;
+    this gives 16 kernels, from (ss|ss) up to (pp|pp).
+*/
+constexpr auto SPECIALIZED_MAX_ANGULAR_MOMENTUM = std::int64_t {1};
+
+/*
+    Calculates the two-electron integral (01|23) between the contracted orbitals of the bra pair (01)
+    and the ket pair (23), using the kernel specialized for their angular momentum class.
+*/
+auto electron_electron_integral_specialized(const ShellPair& bra, const ShellPair& ket) -> double;
+
+}  // namespace elec
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+
+/*
+    An on-disk store for the two-electron integrals, for calculations where the integrals are too
+    many to hold in memory, but too expensive to recalculate during every iteration.
+
+    FILE FORMAT
+    -----------
+    The file is a header, followed by a flat array of records; everything is written in the native
+    byte order of the machine, since the file only ever lives for the length of a calculation.
+
+      header  (32 bytes):
+        - magic               : 8 bytes, the characters "ELECERI1"
+        - version             : uint64
+        - n_basis_functions   : uint64
+        - n_records           : uint64
+
+      record  (16 bytes each):
+        - packed_indices      : uint64, the four basis function indices (i0 i1|i2 i3) of a canonical
+                                quartet, 16 bits each, with i0 in the highest bits
+        - value               : double
+
+    Only the symmetry-unique quartets that survive the screening are written, so a record has to
+    carry its own indices. The records are written and read in large blocks of `RECORDS_PER_BLOCK`
+    records, so that the disk only ever sees long sequential transfers.
+*/
+
+namespace elec
+{
+
+struct TwoElectronIntegralRecord
+{
+    std::uint64_t packed_indices;
+    double value;
+};
+
+static_assert(sizeof(TwoElectronIntegralRecord) == 16, "The records must be tightly packed.");
+
+constexpr auto RECORDS_PER_BLOCK = std::size_t {65536};
+
+/*
+    The largest basis the file format can describe; each index has to fit into 16 bits.
+*/
+constexpr auto TWO_ELECTRON_INTEGRAL_FILE_MAX_BASIS_SIZE = std::size_t {65536};
+
+auto pack_quartet_indices(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) noexcept -> std::uint64_t;
+
+auto unpack_quartet_indices(std::uint64_t packed_indices) noexcept -> TwoElectronIntegralQuartet;
+
+/*
+    Writes the records of a two-electron integral file; they are collected in memory until a full
+    block is ready, and then written out in one go.
+
+    The header is rewritten with the final number of records when the writer is closed; this happens
+    automatically when the writer is destroyed, but calling `close()` directly lets any errors be
+    reported through an exception.
+*/
+class TwoElectronIntegralFileWriter
+{
+public:
+    TwoElectronIntegralFileWriter(const std::filesystem::path& path, std::size_t n_basis_functions);
+    ~TwoElectronIntegralFileWriter();
+
+    TwoElectronIntegralFileWriter(const TwoElectronIntegralFileWriter&) = delete;
+    auto operator=(const TwoElectronIntegralFileWriter&) -> TwoElectronIntegralFileWriter& = delete;
+
+    void write(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double value);
+    void close();
+
+    auto n_records() const noexcept -> std::size_t;
+
+private:
+    std::ofstream stream_;
+    std::size_t n_basis_functions_;
+    std::size_t n_records_ {0};
+    std::vector<TwoElectronIntegralRecord> buffer_;
+
+    void flush_buffer_();
+    void write_header_();
+};
+
+/*
+    Maps a two-electron integral file into memory, and hands out its records one block at a time.
+
+    The kernel is told that the mapping is read sequentially, so that it can read ahead of the
+    current block, and drop the pages that have already been read.
+*/
+class TwoElectronIntegralFileReader
+{
+public:
+    explicit TwoElectronIntegralFileReader(const std::filesystem::path& path);
+    ~TwoElectronIntegralFileReader();
+
+    TwoElectronIntegralFileReader(const TwoElectronIntegralFileReader&) = delete;
+    auto operator=(const TwoElectronIntegralFileReader&) -> TwoElectronIntegralFileReader& = delete;
+
+    /*
+        Iterates over the records of the file, in blocks of up to `RECORDS_PER_BLOCK` records.
+    */
+    class BlockIterator
+    {
+    public:
+        // clang-format off
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::span<const TwoElectronIntegralRecord>;
+        using difference_type   = std::ptrdiff_t;
+        // clang-format on
+
+        BlockIterator(std::span<const TwoElectronIntegralRecord> records, std::size_t i_block);
+
+        auto operator*() const noexcept -> value_type;
+        auto operator++() noexcept -> BlockIterator&;
+        auto operator++(int) noexcept -> BlockIterator;
+        bool operator==(const BlockIterator& other) const noexcept;
+
+    private:
+        std::span<const TwoElectronIntegralRecord> records_;
+        std::size_t i_block_;
+    };
+
+    auto begin() const -> BlockIterator;
+    auto end() const -> BlockIterator;
+
+    auto n_basis_functions() const noexcept -> std::size_t;
+    auto n_records() const noexcept -> std::size_t;
+    auto n_blocks() const noexcept -> std::size_t;
+
+private:
+    void* mapping_ {nullptr};
+    std::size_t mapping_size_ {0};
+    std::size_t n_basis_functions_ {0};
+    std::span<const TwoElectronIntegralRecord> records_;
+};
+
+/*
+    Calculates every symmetry-unique two-electron integral that survives the Schwarz screening, and
+    writes it to a new file at `path`. Returns the number of quartets that were skipped.
+*/
+auto write_two_electron_integral_file(
+    const std::filesystem::path& path,
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> std::size_t;
+
+}  // namespace elec
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cstddef>
-#include <unordered_map>
+#include <span>
+#include <vector>
+
+#include "elecstruct/mathtools/aligned_allocator.hpp"
 
 namespace elec
 {
@@ -9,30 +12,63 @@ namespace elec
 auto yoshimine_sort(std::size_t a, std::size_t b, std::size_t c, std::size_t d) noexcept -> std::size_t;
 
 /*
-    The TwoElectronIntegralGrid is a wrapper around a hashmap that converts the four indices
-    into a Yoshimine index before interfacing with the hashmap.
+    The TwoElectronIntegralGrid is a wrapper around a contiguous array that converts the four
+    indices into a Yoshimine index, and uses that index to directly address the array.
+
+    Because every symmetry-equivalent quartet maps onto the same Yoshimine index, a basis of N
+    functions needs M(M + 1)/2 elements, where M = N(N + 1)/2 is the number of index pairs.
+
+    Elements that have not been set yet hold a quiet NaN.
 */
 class TwoElectronIntegralGrid
 {
 public:
+    static constexpr auto ALIGNMENT = std::size_t {64};
+    using Storage = std::vector<double, elec::math::AlignedAllocator<double, ALIGNMENT>>;
+
+    /*
+        Create an empty grid, that grows as elements are set.
+    */
+    TwoElectronIntegralGrid() = default;
+
+    /*
+        Create a grid with enough space for all the two-electron integrals of a basis with
+        `n_basis_functions` elements.
+    */
+    explicit TwoElectronIntegralGrid(std::size_t n_basis_functions);
+
     /*
         Check if these four indices corresponds to a Yoshimine index that has already been set in
-        the internal mapping.
+        the internal array.
     */
     auto exists(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept -> bool;
 
     /*
         Map the Yoshimine index corresponding to the four basis function indices to the value.
     */
-    auto set(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double value) noexcept -> void;
+    auto set(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double value) -> void;
 
     /*
-        Get the value mapped to from the  Yoshimine index corresponding to the four basis function indices.
+        Get the value mapped to from the Yoshimine index corresponding to the four basis function indices;
+        the indices are not bounds-checked outside of debug builds.
     */
     auto get(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept -> double;
 
+    /*
+        The number of elements in the internal array.
+    */
+    auto size() const noexcept -> std::size_t;
+
+    /*
+        A view of all the elements, in order of increasing Yoshimine index; this matches the order in
+        which the `UniqueQuartetGenerator` visits the quartets, so that the two can be walked through
+        together in a single linear pass.
+    */
+    auto values() const noexcept -> std::span<const double>;
+    auto values() noexcept -> std::span<double>;
+
 private:
-    std::unordered_map<std::size_t, double> integrals_;
+    Storage integrals_ {};
 };
 
 }  // namespace elec
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace elec
+{
+
+/*
+    The four basis function indices of a two-electron integral (i0 i1 | i2 i3).
+*/
+struct TwoElectronIntegralQuartet
+{
+    std::size_t i0;
+    std::size_t i1;
+    std::size_t i2;
+    std::size_t i3;
+
+    constexpr bool operator==(const TwoElectronIntegralQuartet&) const noexcept = default;
+};
+
+/*
+    Iterates over the symmetry-unique quartets of basis function indices of the two-electron
+    integrals, without ever visiting a redundant quartet.
+
+    The real two-electron integrals are unchanged by the swaps (i0 <-> i1), (i2 <-> i3), and
+    (i0 i1) <-> (i2 i3); each set of equivalent quartets is represented by the canonical quartet
+    where
+      - i0 >= i1
+      - i2 >= i3
+      - the compound index of (i0 i1) is at least the compound index of (i2 i3)
+
+    The quartets are visited in increasing order of their Yoshimine index, with no gaps; the
+    n-th quartet produced by the iterator has a Yoshimine index of n.
+*/
+class UniqueQuartetIterator
+{
+public:
+    // clang-format off
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = TwoElectronIntegralQuartet;
+    using size_type         = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = value_type*;
+    using const_pointer     = const value_type*;
+    using iterator          = pointer;
+    using const_iterator    = const_pointer;
+    // clang-format on
+
+    explicit UniqueQuartetIterator(std::size_t n_basis_functions);
+
+    auto operator*() const noexcept -> value_type;
+    auto operator->() const noexcept -> value_type;
+    auto operator++() noexcept -> UniqueQuartetIterator&;
+    auto operator++(int) noexcept -> UniqueQuartetIterator;
+    bool operator==(const UniqueQuartetIterator&) const noexcept;
+    friend auto operator!=(const UniqueQuartetIterator& left, const UniqueQuartetIterator& right) noexcept -> bool;
+
+    void set_to_end() noexcept;
+
+private:
+    std::size_t n_basis_functions_;
+
+    std::size_t i0_ {0};
+    std::size_t i1_ {0};
+    std::size_t i2_ {0};
+    std::size_t i3_ {0};
+};
+
+class UniqueQuartetGenerator
+{
+public:
+    explicit UniqueQuartetGenerator(std::size_t n_basis_functions);
+
+    auto begin() noexcept -> UniqueQuartetIterator;
+    auto end() noexcept -> UniqueQuartetIterator;
+    auto begin() const noexcept -> UniqueQuartetIterator;
+    auto end() const noexcept -> UniqueQuartetIterator;
+
+private:
+    std::size_t n_basis_functions_;
+};
+
+/*
+    The number of symmetry-unique quartets for a basis with `n_basis_functions` elements.
+*/
+auto n_unique_quartets(std::size_t n_basis_functions) noexcept -> std::size_t;
+
+}  // namespace elec
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace elec::math
+{
+
+/*
+    A minimal allocator that places the elements of a container on an `ALIGNMENT`-byte boundary.
+
+    The large arrays of doubles that get streamed through in the hot loops are aligned to the
+    size of a cache line, so that a full SIMD register never straddles two cache lines.
+*/
+template <typename T, std::size_t ALIGNMENT>
+class AlignedAllocator
+{
+public:
+    static_assert(ALIGNMENT >= alignof(T), "The alignment must be at least the natural alignment of the type.");
+    static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "The alignment must be a power of two.");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, ALIGNMENT>;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept
+    {}
+
+    auto allocate(std::size_t n) -> T*
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length {};
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t {ALIGNMENT}));
+    }
+
+    void deallocate(T* ptr, [[maybe_unused]] std::size_t n) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t {ALIGNMENT});
+    }
+
+    friend constexpr auto operator==(const AlignedAllocator&, const AlignedAllocator&) noexcept -> bool
+    {
+        return true;
+    }
+};
+
+}  // namespace elec::math
@@ -1,23 +1,40 @@
 #pragma once
 
+#include <cstddef>
+#include <tuple>
 #include <vector>
 
 #include <Eigen/Dense>
 
 #include "elecstruct/atoms.hpp"
 #include "elecstruct/basis/basis.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/two_electron_integral_file.hpp"
 #include "elecstruct/integrals/two_electron_integral_grid.hpp"
 
 namespace elec
 {
 
+/*
+    The matrix and grid builders can either take the basis directly, or the shell pairs of the basis;
+    passing the shell pairs avoids recalculating the primitive pair data for every builder.
+
+    The two-electron integral builders that take the shell pairs also accept the engine used to
+    calculate the integrals.
+*/
 auto overlap_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> Eigen::MatrixXd;
+auto overlap_matrix(const ShellPairData& shell_pairs) -> Eigen::MatrixXd;
 
 auto transformation_matrix(const Eigen::MatrixXd& s_overlap) -> Eigen::MatrixXd;
 
 auto kinetic_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> Eigen::MatrixXd;
+auto kinetic_matrix(const ShellPairData& shell_pairs) -> Eigen::MatrixXd;
 
 auto nuclear_electron_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, const AtomInfo& atom) -> Eigen::MatrixXd;
+auto nuclear_electron_matrix(const ShellPairData& shell_pairs, const AtomInfo& atom) -> Eigen::MatrixXd;
 
 /*
     Calculates the core Hamiltonian matrix, which is the sum of the kinetic energy matrix
@@ -25,18 +42,172 @@ auto nuclear_electron_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, c
 */
 auto core_hamiltonian_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, const std::vector<AtomInfo>& atoms)
     -> Eigen::MatrixXd;
+auto core_hamiltonian_matrix(const ShellPairData& shell_pairs, const std::vector<AtomInfo>& atoms) -> Eigen::MatrixXd;
+
+/*
+    The overlap matrix, the kinetic energy matrix, and the sum of the nuclear-electron interaction
+    matrices of all the atoms, calculated together in a single pass over the primitive pairs of the
+    basis; this is cheaper than calling each of the separate builders.
+*/
+struct OneElectronMatrices
+{
+    Eigen::MatrixXd overlap_mtx;
+    Eigen::MatrixXd kinetic_mtx;
+    Eigen::MatrixXd nuclear_electron_mtx;
+};
+
+auto one_electron_matrices(const ShellPairData& shell_pairs, const std::vector<AtomInfo>& atoms)
+    -> OneElectronMatrices;
+
+/*
+    The multithreaded version of `one_electron_matrices()`; the output is identical, bit for bit, to
+    that of the single-threaded version.
+
+    The upper triangle of the matrices is split into square tiles, and each tile is weighted by the
+    angular momenta and number of primitives of its pairs, so that the work stealing scheduler can
+    balance the small tiles on the diagonal against the full tiles off of it.
+*/
+auto one_electron_matrices(const ShellPairData& shell_pairs, const std::vector<AtomInfo>& atoms, std::size_t n_threads)
+    -> OneElectronMatrices;
 
 auto two_electron_integral_grid(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> TwoElectronIntegralGrid;
+auto two_electron_integral_grid(
+    const ShellPairData& shell_pairs,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> TwoElectronIntegralGrid;
+
+/*
+    Calculates the two-electron integrals, but skips every quartet that the Schwarz screening
+    marks as negligible; the integrals of these quartets are stored as 0.0.
+
+    Also returns the number of quartets that were skipped.
+*/
+auto screened_two_electron_integral_grid(
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    const SchwarzScreening& screening
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>;
+auto screened_two_electron_integral_grid(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>;
+
+/*
+    The multithreaded version of `screened_two_electron_integral_grid()`; the output is identical, bit
+    for bit, to that of the single-threaded version.
+
+    The unique quartets are grouped into one task per bra pair (i0 i1), and each task is weighted by
+    the angular momenta and number of primitives of the orbitals in its quartets, so that the work
+    stealing scheduler can start the expensive tasks first.
+*/
+auto screened_two_electron_integral_grid(
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    const SchwarzScreening& screening,
+    std::size_t n_threads
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>;
+auto screened_two_electron_integral_grid(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    std::size_t n_threads,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>;
 
 auto density_matrix_restricted_hartree_fock(const Eigen::MatrixXd& coefficient_mtx, std::size_t n_electrons)
     -> Eigen::MatrixXd;
 
+/*
+    The in-place version of `density_matrix_restricted_hartree_fock()`, which writes into a density matrix
+    that already has the size of the basis, instead of allocating a new one.
+*/
+void density_matrix_restricted_hartree_fock(
+    Eigen::MatrixXd& density_mtx,
+    const Eigen::MatrixXd& coefficient_mtx,
+    std::size_t n_electrons
+);
+
+/*
+    Calculates the two-electron part of the Fock matrix,
+
+        G(i0, i1) = sum_{i2, i3} D(i2, i3) [(i0 i1|i2 i3) - 0.5 (i0 i3|i2 i1)]
+
+    in a single linear pass over the stored integrals; each symmetry-unique integral is read once,
+    and added to every element of G that it contributes to.
+*/
 auto electron_electron_matrix(
     const std::vector<AtomicOrbitalInfoSTO3G>& basis,
     const Eigen::MatrixXd& density_matrix,
     const TwoElectronIntegralGrid& two_electron_integrals
 ) -> Eigen::MatrixXd;
 
+/*
+    The Coulomb and exchange matrices,
+
+        J(i0, i1) = sum_{i2, i3} D(i2, i3) (i0 i1|i2 i3)
+        K(i0, i1) = sum_{i2, i3} D(i2, i3) (i0 i3|i2 i1)
+
+    which make up the two-electron part of the Fock matrix as G = J - 0.5 K.
+*/
+struct CoulombExchangeMatrices
+{
+    Eigen::MatrixXd coulomb;
+    Eigen::MatrixXd exchange;
+};
+
+/*
+    Calculates J and K together, in a single linear pass over the stored integrals; the size of the
+    basis is taken from the density matrix.
+*/
+auto coulomb_exchange_matrices(
+    const Eigen::MatrixXd& density_matrix,
+    const TwoElectronIntegralGrid& two_electron_integrals
+) -> CoulombExchangeMatrices;
+
+auto coulomb_matrix(const Eigen::MatrixXd& density_matrix, const TwoElectronIntegralGrid& two_electron_integrals)
+    -> Eigen::MatrixXd;
+
+auto exchange_matrix(const Eigen::MatrixXd& density_matrix, const TwoElectronIntegralGrid& two_electron_integrals)
+    -> Eigen::MatrixXd;
+
+/*
+    J, K, and G = J - 0.5 K from factorized integrals, such as those from density fitting or from the
+    Cholesky decomposition of the two-electron integrals.
+*/
+auto coulomb_exchange_matrices(
+    const Eigen::MatrixXd& density_matrix,
+    const FactorizedTwoElectronIntegrals& factorized_integrals
+) -> CoulombExchangeMatrices;
+
+auto electron_electron_matrix(
+    const FactorizedTwoElectronIntegrals& factorized_integrals,
+    const Eigen::MatrixXd& density_matrix
+) -> Eigen::MatrixXd;
+
+/*
+    Adds the contributions of the symmetry-unique integral (i0 i1|i2 i3) to the two-electron part of
+    the Fock matrix, on behalf of all of the symmetry-equivalent quartets that it represents.
+
+    Only one of each pair of transposed elements receives each contribution; once every unique
+    integral has been added, the matrix has to be symmetrized as 0.5 * (G + G^T).
+*/
+void add_unique_integral_contributions(
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& density_matrix,
+    std::size_t i0,
+    std::size_t i1,
+    std::size_t i2,
+    std::size_t i3,
+    double integral
+) noexcept;
+
+/*
+    Calculates the two-electron part of the Fock matrix in a single sequential pass over the records
+    of a two-electron integral file.
+*/
+auto electron_electron_matrix(
+    const TwoElectronIntegralFileReader& integral_file,
+    const Eigen::MatrixXd& density_matrix
+) -> Eigen::MatrixXd;
+
 auto fock_matrix(
     const Eigen::MatrixXd& old_density_mtx,
     const std::vector<AtomicOrbitalInfoSTO3G>& basis,
@@ -44,4 +215,48 @@ auto fock_matrix(
     const Eigen::MatrixXd& core_hamiltonian_mtx
 ) -> Eigen::MatrixXd;
 
+auto fock_matrix(
+    const Eigen::MatrixXd& old_density_mtx,
+    const TwoElectronIntegralFileReader& integral_file,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+) -> Eigen::MatrixXd;
+
+auto fock_matrix(
+    const Eigen::MatrixXd& old_density_mtx,
+    const FactorizedTwoElectronIntegrals& factorized_integrals,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+) -> Eigen::MatrixXd;
+
+/*
+    The in-place versions of `fock_matrix()`, which write into matrices that already have the size of the
+    basis, instead of allocating new ones; the two-electron part is accumulated in `electron_electron_mtx`
+    before it is symmetrized into the Fock matrix. For the factorized integrals, the Coulomb matrix is built
+    in `electron_electron_mtx`, and the exchange matrix in `fock_mtx`, before either is combined.
+
+    The output is identical, bit for bit, to that of the versions that return a new matrix.
+*/
+void fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& old_density_mtx,
+    const TwoElectronIntegralGrid& two_electron_integrals,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+);
+
+void fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& old_density_mtx,
+    const TwoElectronIntegralFileReader& integral_file,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+);
+
+void fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& old_density_mtx,
+    const FactorizedTwoElectronIntegrals& factorized_integrals,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+);
+
 }  // namespace elec
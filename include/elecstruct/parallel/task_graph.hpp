@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace elec::parallel
+{
+
+/*
+    When a task of a graph started, relative to the start of the run, and how long it took; both are
+    in seconds. A task that was skipped, because a task it depends on threw, has neither.
+*/
+struct TaskTiming
+{
+    std::string name;
+    double start_seconds;
+    double seconds;
+    bool is_skipped;
+};
+
+/*
+    A small set of named tasks, where each task only starts once every task it depends on has finished.
+
+    A task can only depend on tasks that were added before it, so the graph can never have a cycle.
+*/
+class TaskGraph
+{
+public:
+    using NodeId = std::size_t;
+
+    auto add(std::string name, std::function<void()> work, const std::vector<NodeId>& dependencies = {}) -> NodeId;
+
+    /*
+        Runs every task exactly once across up to `n_threads` threads, and returns once all of them have
+        finished; the calling thread acts as one of the workers. The tasks that are ready to run are
+        started in the order they were added.
+
+        If a task throws, every task that depends on it (directly or not) is skipped, the remaining tasks
+        still run, and the first exception is rethrown once all threads have been joined.
+
+        Returns the timings of the tasks, in the order they were added.
+    */
+    auto run(std::size_t n_threads) -> std::vector<TaskTiming>;
+
+    auto size() const noexcept -> std::size_t;
+
+private:
+    struct Node
+    {
+        std::string name;
+        std::function<void()> work;
+        std::size_t n_dependencies;
+        std::vector<NodeId> dependents;
+    };
+
+    std::vector<Node> nodes_;
+};
+
+}  // namespace elec::parallel
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace elec::parallel
+{
+
+/*
+    A unit of work, along with an estimate of how expensive it is to perform. Only the relative
+    sizes of the costs matter.
+*/
+struct WeightedTask
+{
+    double cost;
+    std::function<void()> work;
+};
+
+/*
+    Runs every task exactly once across `n_threads` threads, and returns once all of them have finished.
+
+    The tasks are first dealt out to per-thread queues, most expensive first, always to the queue with
+    the smallest total cost so far. Each thread works through its own queue from the front; once it runs
+    out, it steals tasks from the back of the other threads' queues. This keeps every thread busy even
+    when the cost estimates are off, or when a few tasks are far more expensive than the rest.
+
+    The calling thread acts as one of the workers. If any task throws, the remaining tasks still run,
+    and the first exception is rethrown once all threads have been joined.
+*/
+void run_work_stealing(std::vector<WeightedTask> tasks, std::size_t n_threads);
+
+}  // namespace elec::parallel
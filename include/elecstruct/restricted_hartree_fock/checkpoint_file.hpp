@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+
+/*
+    A checkpoint of a self-consistent field calculation, so that a calculation that gets killed can
+    be resumed without recalculating the two-electron integrals, or losing its progress towards
+    convergence.
+
+    FILE FORMAT
+    -----------
+    The file is a header, followed by several sections laid out back to back; everything is written
+    in the native byte order of the machine. Every section is made of 8-byte elements, so that every
+    section is suitably aligned to be used in place once the file is mapped into memory.
+
+      header  (64 bytes):
+        - magic                     : 8 bytes, the characters "ELECCHK1"
+        - version                   : uint64
+        - n_basis_functions         : uint64, N
+        - basis_hash                : uint64, a hash of the basis functions (including their positions)
+        - iteration                 : uint64, the last iteration that completed before the checkpoint
+        - n_diis_entries            : uint64, K
+        - n_two_electron_integrals  : uint64, L (zero if the integrals were not stored)
+        - reserved                  : uint64
+
+      sections:
+        - basis functions           : N records of `CheckpointBasisFunction`
+        - overlap matrix            : N * N doubles, column-major
+        - core Hamiltonian matrix   : N * N doubles, column-major
+        - density matrix            : N * N doubles, column-major
+        - DIIS Fock matrices        : K * N * N doubles, from the oldest to the most recent
+        - DIIS error matrices       : K * N * N doubles, from the oldest to the most recent
+        - two-electron integrals    : L doubles, in the order of the `TwoElectronIntegralGrid`
+
+    A checkpoint is first written to a temporary file next to `path`, which then replaces `path`;
+    a calculation killed during a write leaves the previous checkpoint in place.
+*/
+
+namespace elec
+{
+
+/*
+    The description of a single basis function, as it is stored in a checkpoint file.
+*/
+struct CheckpointBasisFunction
+{
+    std::int64_t atom_label;
+    std::int64_t orbital_label;
+    std::array<std::int64_t, 3> angular_momentum;
+    std::array<double, 3> position;
+};
+
+static_assert(sizeof(CheckpointBasisFunction) == 64, "The basis function records must be tightly packed.");
+
+/*
+    A hash of everything that describes the basis: the kinds of the basis functions, their angular
+    momenta, their positions, and their contraction coefficients and exponents. Two calculations can
+    only share a checkpoint if their bases have the same hash.
+*/
+auto basis_hash(const std::vector<AtomicOrbitalInfoSTO3G>& basis) noexcept -> std::uint64_t;
+
+/*
+    Writes a checkpoint file; `diis` may be null if the calculation does not use DIIS, and
+    `two_electron_integrals` may be empty if the calculation does not store its integrals.
+*/
+void write_checkpoint_file(
+    const std::filesystem::path& path,
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    std::size_t iteration,
+    const Eigen::MatrixXd& overlap_mtx,
+    const Eigen::MatrixXd& core_hamiltonian_mtx,
+    const Eigen::MatrixXd& density_mtx,
+    const DiisExtrapolator* diis,
+    std::span<const double> two_electron_integrals
+);
+
+/*
+    Maps a checkpoint file into memory. Nothing is parsed or copied; the matrices and integrals are
+    views directly into the mapping, and stay valid for as long as the reader does.
+*/
+class CheckpointFileReader
+{
+public:
+    using MatrixView = Eigen::Map<const Eigen::MatrixXd>;
+
+    explicit CheckpointFileReader(const std::filesystem::path& path);
+    ~CheckpointFileReader();
+
+    CheckpointFileReader(const CheckpointFileReader&) = delete;
+    auto operator=(const CheckpointFileReader&) -> CheckpointFileReader& = delete;
+
+    /*
+        Whether the checkpoint was written for a calculation with this basis.
+    */
+    auto matches_basis(const std::vector<AtomicOrbitalInfoSTO3G>& basis) const noexcept -> bool;
+
+    auto n_basis_functions() const noexcept -> std::size_t;
+    auto basis_hash() const noexcept -> std::uint64_t;
+    auto iteration() const noexcept -> std::size_t;
+    auto n_diis_entries() const noexcept -> std::size_t;
+
+    auto basis_functions() const noexcept -> std::span<const CheckpointBasisFunction>;
+    auto overlap_matrix() const noexcept -> MatrixView;
+    auto core_hamiltonian_matrix() const noexcept -> MatrixView;
+    auto density_matrix() const noexcept -> MatrixView;
+    auto diis_fock_matrix(std::size_t i_entry) const -> MatrixView;
+    auto diis_error_matrix(std::size_t i_entry) const -> MatrixView;
+    auto two_electron_integrals() const noexcept -> std::span<const double>;
+
+private:
+    void* mapping_ {nullptr};
+    std::size_t mapping_size_ {0};
+
+    std::size_t n_basis_functions_ {0};
+    std::uint64_t basis_hash_ {0};
+    std::size_t iteration_ {0};
+    std::size_t n_diis_entries_ {0};
+
+    std::span<const CheckpointBasisFunction> basis_functions_;
+    const double* matrices_ {nullptr};
+    std::span<const double> two_electron_integrals_;
+
+    auto matrix_(std::size_t i_matrix) const noexcept -> MatrixView;
+};
+
+}  // namespace elec
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+/*
+    Pulay's direct inversion in the iterative subspace (DIIS), which speeds up the convergence of
+    the self-consistent field iterations.
+
+    Instead of diagonalizing the most recent Fock matrix, the next density matrix is calculated from
+    a linear combination of the most recent Fock matrices, F = sum_i c_i F_i, where the coefficients
+    minimize the norm of the same combination of their error matrices, under the constraint that
+    sum_i c_i = 1.
+*/
+
+namespace elec
+{
+
+/*
+    Calculates the error matrix FDS - SDF of a Fock matrix, and the density matrix it was built from.
+    The Fock and density matrices commute (in the metric of the overlap matrix) exactly when they
+    are self-consistent, so this matrix vanishes at convergence.
+*/
+auto diis_error_matrix(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& density_mtx,
+    const Eigen::MatrixXd& overlap_mtx
+) -> Eigen::MatrixXd;
+
+/*
+    The in-place version of `diis_error_matrix()`, which writes into matrices that already have the size
+    of the basis; the product FD is kept in `fock_density_mtx` on the way.
+*/
+void diis_error_matrix(
+    Eigen::MatrixXd& error_mtx,
+    Eigen::MatrixXd& fock_density_mtx,
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& density_mtx,
+    const Eigen::MatrixXd& overlap_mtx
+);
+
+/*
+    Holds the most recent Fock matrices and their error matrices, and extrapolates a new Fock matrix
+    from them. Once `history_length` pairs are stored, pushing a new pair discards the oldest one.
+
+    The pairs are kept in a ring of `history_length` slots, which are allocated on the first push, once
+    the size of the matrices is known; a new pair is copied over the slot of the pair it evicts.
+*/
+class DiisExtrapolator
+{
+public:
+    explicit DiisExtrapolator(std::size_t history_length = DEFAULT_DIIS_HISTORY_LENGTH);
+
+    /*
+        Stores a copy of a Fock matrix and its error matrix. Throws if their size differs from that of
+        the matrices that were pushed before.
+    */
+    void push(const Eigen::MatrixXd& fock_mtx, const Eigen::MatrixXd& error_mtx);
+
+    /*
+        The linear combination of the stored Fock matrices whose error matrix has the smallest norm.
+        Throws if nothing has been stored.
+    */
+    auto extrapolate() const -> Eigen::MatrixXd;
+
+    /*
+        The in-place version of `extrapolate()`; `fock_mtx` must already have the size of the stored
+        Fock matrices.
+    */
+    void extrapolate(Eigen::MatrixXd& fock_mtx) const;
+
+    /*
+        The coefficients of the stored Fock matrices in the extrapolated Fock matrix, from the oldest
+        to the most recent.
+    */
+    auto coefficients() const -> Eigen::VectorXd;
+
+    /*
+        The largest element, in absolute value, of the most recently stored error matrix.
+    */
+    auto max_error() const -> double;
+
+    auto n_stored() const noexcept -> std::size_t;
+
+    /*
+        The stored Fock and error matrices, where `i_stored` counts from the oldest to the most recent.
+    */
+    auto fock_matrix(std::size_t i_stored) const -> const Eigen::MatrixXd&;
+    auto error_matrix(std::size_t i_stored) const -> const Eigen::MatrixXd&;
+
+    auto history_length() const noexcept -> std::size_t;
+
+private:
+    std::size_t history_length_;
+
+    std::size_t n_stored_ {0};
+    std::size_t i_next_slot_ {0};
+
+    std::vector<Eigen::MatrixXd> fock_matrices_;
+    std::vector<Eigen::MatrixXd> error_matrices_;
+
+    // the inner products of the error matrices in every pair of slots; only the row and column of the
+    // slot of a newly stored error matrix are calculated, instead of the whole matrix every time
+    Eigen::MatrixXd error_overlaps_;
+
+    auto slot_(std::size_t i_stored) const noexcept -> std::size_t;
+    void check_not_empty_() const;
+};
+
+}  // namespace elec
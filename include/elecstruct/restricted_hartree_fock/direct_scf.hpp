@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+/*
+    The pieces needed for an integral-direct SCF calculation, where the two-electron integrals are
+    recalculated whenever the Fock matrix is built, instead of being stored in memory. The memory
+    use then only grows as N^2 with the number of basis functions, instead of N^4.
+*/
+
+namespace elec
+{
+
+/*
+    Calculates the two-electron part of the Fock matrix,
+
+        G(i0, i1) = sum_{i2, i3} D(i2, i3) [(i0 i1|i2 i3) - 0.5 (i0 i3|i2 i1)]
+
+    by calculating each symmetry-unique integral once, and adding its contribution to every element
+    of G that it appears in.
+
+    The screening is weighted by the density matrix; a quartet is skipped if its Schwarz bound,
+    multiplied by the largest density matrix element that it gets multiplied by, falls below the
+    tolerance of the screening. Also returns the number of quartets that were skipped.
+*/
+auto electron_electron_matrix_direct(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    const Eigen::MatrixXd& density_mtx,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> std::tuple<Eigen::MatrixXd, std::size_t>;
+
+/*
+    The in-place version of `electron_electron_matrix_direct()`, which writes into a matrix that already
+    has the size of the basis, and returns the number of quartets that were skipped.
+*/
+auto electron_electron_matrix_direct(
+    Eigen::MatrixXd& electron_electron_mtx,
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    const Eigen::MatrixXd& density_mtx,
+    ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE
+) -> std::size_t;
+
+/*
+    Keeps track of the two-electron part of the Fock matrix over the iterations of a direct SCF
+    calculation.
+
+    Since G is linear in the density matrix, G[D_new] = G[D_old] + G[D_new - D_old], and only the
+    change in the density matrix needs to be contracted with the integrals. This change shrinks as
+    the calculation converges, so the density-weighted screening skips more and more quartets in the
+    later iterations.
+
+    Every `full_rebuild_period` updates, G is instead rebuilt from the full density matrix, so that
+    the errors from the screening cannot keep accumulating.
+
+    The shell pairs and the screening are held by reference, and must outlive this object.
+*/
+class IncrementalElectronElectronMatrix
+{
+public:
+    IncrementalElectronElectronMatrix(
+        const ShellPairData& shell_pairs,
+        const SchwarzScreening& screening,
+        ElectronElectronEngine engine = DEFAULT_ELECTRON_ELECTRON_ENGINE,
+        std::size_t full_rebuild_period = DEFAULT_DIRECT_SCF_FULL_REBUILD_PERIOD
+    );
+
+    /*
+        Brings the two-electron matrix up to date with `density_mtx`, and returns it.
+    */
+    auto update(const Eigen::MatrixXd& density_mtx) -> const Eigen::MatrixXd&;
+
+    /*
+        The number of quartets skipped during the most recent update.
+    */
+    auto n_skipped() const noexcept -> std::size_t;
+
+    /*
+        Whether the most recent update rebuilt the matrix from the full density matrix.
+    */
+    auto was_full_rebuild() const noexcept -> bool;
+
+private:
+    const ShellPairData& shell_pairs_;
+    const SchwarzScreening& screening_;
+    ElectronElectronEngine engine_;
+    std::size_t full_rebuild_period_;
+
+    std::size_t n_updates_ {0};
+    std::size_t n_skipped_ {0};
+    bool was_full_rebuild_ {false};
+
+    Eigen::MatrixXd density_mtx_;
+    Eigen::MatrixXd electron_electron_mtx_;
+
+    // the change in the density matrix, and the change in G that it causes, during an incremental update
+    Eigen::MatrixXd density_change_mtx_;
+    Eigen::MatrixXd electron_electron_change_mtx_;
+};
+
+}  // namespace elec
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <Eigen/Dense>
 
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/orbitals.hpp"
+
 /*
     NOTE: right now we only have the zero matrix, but I may add other ones later.
 */
@@ -35,4 +41,24 @@ auto extended_huckel_guess(const Eigen::MatrixXd& overlap_mtx, const Eigen::Matr
 */
 auto core_hamiltonian_guess(const Eigen::MatrixXd& core_hamiltonian_mtx) -> Eigen::MatrixXd;
 
+/*
+    The density matrix of a single, isolated, neutral atom at the origin, with the given atomic orbitals
+    in the STO-3G basis. It comes from a spherically averaged Hartree-Fock calculation, where the
+    electrons of a partially filled shell are spread out evenly over all of its orbitals.
+
+    The density matrix of each kind of atom is calculated only once per process; later calls return
+    the cached matrix. It is safe to call this function from several threads at once.
+*/
+auto atomic_density_matrix(AtomLabel label, const std::vector<AtomicOrbitalLabel>& orbitals) -> const Eigen::MatrixXd&;
+
+/*
+    Approximate the density matrix of a molecule with the superposition of the density matrices of
+    its atoms (SAD). The result is block-diagonal, with one block per atom; it is rescaled to hold
+    `n_electrons` electrons, in case the molecule is charged.
+
+    Unlike the other guesses, this one is a guess for the density matrix, and not the Fock matrix.
+*/
+auto superposition_of_atomic_densities(const std::vector<AtomInfo>& atoms, std::size_t n_electrons)
+    -> Eigen::MatrixXd;
+
 }  // namespace elec
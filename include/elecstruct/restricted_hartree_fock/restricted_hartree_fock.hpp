@@ -1,8 +1,14 @@
 #pragma once
 
 #include <cstddef>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <ostream>
 #include <vector>
 
+#include <Eigen/Dense>
+
 #include "elecstruct/atoms.hpp"
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/input_file_parser/input_file_options.hpp"
@@ -10,14 +16,76 @@
 namespace elec
 {
 
-void perform_restricted_hartree_fock(
+/*
+    The settings that control a restricted Hartree-Fock calculation.
+*/
+struct RestrictedHartreeFockOptions
+{
+    InitialFockGuess initial_fock;
+    std::size_t n_electrons;
+    std::size_t n_max_iter;
+    double tolerance_change_density_matrix;
+    Verbose is_verbose;
+    double schwarz_screening_tolerance {DEFAULT_SCHWARZ_SCREENING_TOLERANCE};
+    std::size_t n_threads {DEFAULT_N_THREADS};
+    ElectronElectronEngine electron_electron_engine {DEFAULT_ELECTRON_ELECTRON_ENGINE};
+    ScfMode scf_mode {DEFAULT_SCF_MODE};
+    std::size_t direct_scf_full_rebuild_period {DEFAULT_DIRECT_SCF_FULL_REBUILD_PERIOD};
+    double cholesky_threshold {DEFAULT_CHOLESKY_THRESHOLD};
+    std::size_t diis_start_iteration {DEFAULT_DIIS_START_ITERATION};
+    std::size_t diis_history_length {DEFAULT_DIIS_HISTORY_LENGTH};
+
+    // a warm start from an earlier calculation on the same basis (for example, at a nearby geometry);
+    // if either is given, it replaces `initial_fock` as the starting point, and at most one may be given
+    std::optional<Eigen::MatrixXd> initial_density_mtx {};
+    std::optional<Eigen::MatrixXd> initial_coefficient_mtx {};
+
+    // if a checkpoint file is given, the state of the calculation is written to it periodically; with
+    // `restart_from_checkpoint`, the calculation resumes from the state in the file instead of starting
+    // over, and takes precedence over any other starting point
+    std::optional<std::filesystem::path> checkpoint_path {};
+    std::size_t checkpoint_period {DEFAULT_CHECKPOINT_PERIOD};
+    bool restart_from_checkpoint {false};
+
+    // where the progress of the calculation is written; if null, nothing is written
+    std::ostream* output {&std::cout};
+};
+
+/*
+    What happened during a single iteration of a restricted Hartree-Fock calculation.
+*/
+struct ScfIterationInfo
+{
+    std::size_t iteration;
+    double total_energy;
+    double density_matrix_difference;
+    double diis_error;  // zero if DIIS is turned off
+    double seconds;
+};
+
+/*
+    The converged (or last, if the calculation did not converge) state of a restricted Hartree-Fock
+    calculation. The orbital energies are in increasing order, and the columns of the coefficient
+    matrix are in the same order.
+*/
+struct RestrictedHartreeFockResult
+{
+    bool is_converged;
+    std::size_t n_iterations;
+    double total_energy;
+    Eigen::VectorXd orbital_energies;
+    Eigen::MatrixXd coefficient_mtx;
+    Eigen::MatrixXd density_mtx;
+    Eigen::MatrixXd fock_mtx;
+    std::vector<ScfIterationInfo> history;
+    double setup_seconds;
+    double total_seconds;
+};
+
+auto perform_restricted_hartree_fock(
     const std::vector<AtomInfo>& atoms,
     const std::vector<AtomicOrbitalInfoSTO3G>& basis,
-    InitialFockGuess initial_fock,
-    std::size_t n_electrons,
-    std::size_t n_max_iter,
-    double tolerance_change_density_matrix,
-    Verbose is_verbose
-);
+    const RestrictedHartreeFockOptions& options
+) -> RestrictedHartreeFockResult;
 
 }  // namespace elec
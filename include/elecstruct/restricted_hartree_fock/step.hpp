@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -21,6 +22,22 @@ auto matrix_with_sorted_columns(const Eigen::MatrixXd& matrix, const std::vector
 */
 auto indices_to_sort(const Eigen::VectorXd& elements) -> std::vector<Eigen::Index>;
 
+/*
+    The orbital energies, in increasing order, and the matching columns of the coefficient matrix, that
+    come from diagonalizing a Fock matrix.
+*/
+struct MolecularOrbitals
+{
+    Eigen::VectorXd energies;
+    Eigen::MatrixXd coefficient_mtx;
+};
+
+/*
+    Diagonalize the Fock matrix, in the orthogonal basis given by the transformation matrix.
+*/
+auto molecular_orbitals(const Eigen::MatrixXd& fock_mtx, const Eigen::MatrixXd& basis_transformation_mtx)
+    -> MolecularOrbitals;
+
 /*
     Calculate the density matrix consistent with the provided Fock matrix.
 */
@@ -30,6 +47,61 @@ auto new_density_matrix(
     std::size_t n_electrons
 ) -> Eigen::MatrixXd;
 
+/*
+    Every buffer that an SCF iteration works in, allocated once for the size of the basis, so that the
+    iterations themselves do not allocate; the in-place versions of the step functions write into these
+    buffers instead of returning new matrices.
+*/
+struct ScfWorkspace
+{
+    explicit ScfWorkspace(std::size_t n_basis_functions);
+
+    auto n_basis_functions() const noexcept -> std::size_t;
+
+    // the Fock matrix, and the two-electron part that is accumulated before it is symmetrized into it
+    Eigen::MatrixXd fock_mtx;
+    Eigen::MatrixXd electron_electron_mtx;
+
+    // X^T F, and then X^T F X, the Fock matrix in the orthogonal basis
+    Eigen::MatrixXd half_transformed_fock_mtx;
+    Eigen::MatrixXd transformed_fock_mtx;
+
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigensolver;
+
+    // the orbitals of the most recent diagonalization
+    Eigen::VectorXd orbital_energies;
+    Eigen::MatrixXd coefficient_mtx;
+
+    // the density matrix of the most recent diagonalization
+    Eigen::MatrixXd density_mtx;
+
+    // the DIIS error matrix FDS - SDF, the product FD it is built from, and the extrapolated Fock matrix
+    Eigen::MatrixXd diis_error_mtx;
+    Eigen::MatrixXd fock_density_mtx;
+    Eigen::MatrixXd extrapolated_fock_mtx;
+};
+
+/*
+    The in-place version of `molecular_orbitals()`; the orbital energies and the coefficient matrix are
+    written into `workspace.orbital_energies` and `workspace.coefficient_mtx`.
+*/
+void molecular_orbitals(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& basis_transformation_mtx,
+    ScfWorkspace& workspace
+);
+
+/*
+    The in-place version of `new_density_matrix()`; the density matrix is written into
+    `workspace.density_mtx`.
+*/
+void new_density_matrix(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& basis_transformation_mtx,
+    std::size_t n_electrons,
+    ScfWorkspace& workspace
+);
+
 /*
     Calculate the differences between two density matrices; used in iteration procedures to
     determine how similar the current density matrix is to the density matrix from the previous
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "elecstruct/basis/basis_sets/sto3g.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "elecstruct/basis/auxiliary_basis.hpp"
+
+namespace
+{
+
+/*
+    The range of exponents and angular momenta of the orbitals that sit on a single centre.
+*/
+struct CentreInfo
+{
+    coord::Cartesian3D position;
+    double min_exponent {std::numeric_limits<double>::max()};
+    double max_exponent {0.0};
+    std::int64_t max_angular_momentum {0};
+};
+
+auto same_position(const coord::Cartesian3D& point0, const coord::Cartesian3D& point1) noexcept -> bool
+{
+    return point0.x == point1.x && point0.y == point1.y && point0.z == point1.z;
+}
+
+auto group_orbitals_by_centre(const std::vector<elec::AtomicOrbitalInfoSTO3G>& basis) -> std::vector<CentreInfo>
+{
+    auto centres = std::vector<CentreInfo> {};
+
+    for (const auto& orbital : basis) {
+        auto it_centre = std::find_if(
+            centres.begin(),
+            centres.end(),
+            [&](const CentreInfo& centre) { return same_position(centre.position, orbital.position); }
+        );
+
+        if (it_centre == centres.end()) {
+            centres.push_back(CentreInfo {orbital.position});
+            it_centre = std::prev(centres.end());
+        }
+
+        for (const auto& gaussian : orbital.gaussians) {
+            it_centre->min_exponent = std::min(it_centre->min_exponent, gaussian.exponent_coeff);
+            it_centre->max_exponent = std::max(it_centre->max_exponent, gaussian.exponent_coeff);
+        }
+
+        const auto angmom = elec::total_angular_momentum(orbital.angular_momentum);
+        it_centre->max_angular_momentum = std::max(it_centre->max_angular_momentum, angmom);
+    }
+
+    return centres;
+}
+
+/*
+    Every combination of (x, y, z) with x + y + z == angmom.
+*/
+auto cartesian_components(std::int64_t angmom) -> std::vector<elec::AngularMomentumNumbers>
+{
+    auto components = std::vector<elec::AngularMomentumNumbers> {};
+
+    for (std::int64_t x {angmom}; x >= 0; --x) {
+        for (std::int64_t y {angmom - x}; y >= 0; --y) {
+            components.push_back({x, y, angmom - x - y});
+        }
+    }
+
+    return components;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto create_even_tempered_auxiliary_basis(const std::vector<AtomicOrbitalInfoSTO3G>& basis, double ratio)
+    -> std::vector<AuxiliaryFunctionInfo>
+{
+    if (ratio <= 1.0) {
+        throw std::runtime_error {"The ratio of an even-tempered auxiliary basis must be greater than 1."};
+    }
+
+    auto aux_basis = std::vector<AuxiliaryFunctionInfo> {};
+
+    for (const auto& centre : group_orbitals_by_centre(basis)) {
+        const auto smallest = 2.0 * centre.min_exponent;
+        const auto largest = 2.0 * centre.max_exponent;
+        const auto n_steps = std::ceil(std::log(largest / smallest) / std::log(ratio));
+        const auto n_exponents = static_cast<std::size_t>(n_steps) + 1;
+
+        for (std::int64_t angmom {0}; angmom <= 2 * centre.max_angular_momentum; ++angmom) {
+            const auto components = cartesian_components(angmom);
+
+            auto exponent = smallest;
+            for (std::size_t i_exponent {0}; i_exponent < n_exponents; ++i_exponent) {
+                for (const auto& component : components) {
+                    aux_basis.push_back({centre.position, component, exponent});
+                }
+                exponent *= ratio;
+            }
+        }
+    }
+
+    return aux_basis;
+}
+
+}  // namespace elec
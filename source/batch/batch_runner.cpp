@@ -0,0 +1,310 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/input_file_parser/input_file_parser.hpp"
+#include "elecstruct/input_file_parser/parsed_information.hpp"
+#include "elecstruct/parallel/work_stealing.hpp"
+#include "elecstruct/restricted_hartree_fock/restricted_hartree_fock.hpp"
+
+#include "elecstruct/batch/batch_runner.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+auto seconds_since(Clock::time_point start) -> double
+{
+    return std::chrono::duration<double> {Clock::now() - start}.count();
+}
+
+/*
+    Everything a job needs to run its calculation, once its input file has been parsed.
+*/
+struct PreparedJob
+{
+    std::vector<elec::AtomInfo> atoms;
+    std::vector<elec::AtomicOrbitalInfoSTO3G> basis;
+    elec::RestrictedHartreeFockOptions options;
+};
+
+auto prepare_job(const std::filesystem::path& input_path, std::size_t n_threads_per_job) -> PreparedJob
+{
+    auto toml_stream = std::ifstream {input_path};
+    if (!toml_stream.is_open()) {
+        throw std::runtime_error {"Failed to open the input file."};
+    }
+
+    auto parser = elec::InputFileParser {toml_stream};
+    if (!parser.is_valid()) {
+        throw std::runtime_error {"Failed to parse the input file: " + parser.error_message()};
+    }
+
+    parser.parse_all();
+    const auto& info = parser.parsed_information();
+
+    auto atoms = info.atom_information();
+    elec::fill_atomic_orbitals_sto3g(atoms);
+
+    auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+
+    auto options = elec::restricted_hartree_fock_options(info);
+    options.n_threads = n_threads_per_job;
+
+    return {std::move(atoms), std::move(basis), std::move(options)};
+}
+
+/*
+    The cost of a calculation is dominated by the two-electron integrals, whose number grows as the
+    fourth power of the size of the basis.
+*/
+auto estimated_cost(const PreparedJob& job) -> double
+{
+    return std::pow(static_cast<double>(job.basis.size()), 4);
+}
+
+/*
+    Two input files in different directories can have the same stem, and their jobs can run at the same
+    time; the index of the job keeps their log files apart.
+*/
+auto log_file_path(
+    const std::filesystem::path& log_directory,
+    const std::filesystem::path& input_path,
+    std::size_t i_job
+) -> std::filesystem::path
+{
+    auto filename = std::filesystem::path {std::to_string(i_job) + "_"};
+    filename += input_path.stem();
+    filename += ".log";
+
+    return log_directory / filename;
+}
+
+auto status_name(elec::BatchJobStatus status) -> std::string
+{
+    using BJS = elec::BatchJobStatus;
+
+    switch (status) {
+        case BJS::CONVERGED : {
+            return "converged";
+        }
+        case BJS::NOT_CONVERGED : {
+            return "not_converged";
+        }
+        case BJS::FAILED : {
+            return "failed";
+        }
+        default : {
+            throw std::runtime_error {"UNREACHABLE: unknown BatchJobStatus passed to function!"};
+        }
+    }
+}
+
+/*
+    Removes the whitespace at both ends of a line of the manifest.
+*/
+auto trimmed(const std::string& line) -> std::string
+{
+    const auto is_space = [](unsigned char c) { return std::isspace(c) != 0; };
+
+    const auto begin = std::find_if_not(line.begin(), line.end(), is_space);
+    const auto end = std::find_if_not(line.rbegin(), line.rend(), is_space).base();
+
+    return (begin < end) ? std::string {begin, end} : std::string {};
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto restricted_hartree_fock_options(const ParsedInformation& info) -> RestrictedHartreeFockOptions
+{
+    return RestrictedHartreeFockOptions {
+        .initial_fock = info.initial_fock_guess(),
+        .n_electrons = info.n_electrons(),
+        .n_max_iter = info.max_hartree_fock_iterations(),
+        .tolerance_change_density_matrix = info.tol_change_density_matrix(),
+        .is_verbose = info.verbose(),
+        .schwarz_screening_tolerance = info.schwarz_screening_tolerance(),
+        .n_threads = info.n_threads(),
+        .electron_electron_engine = info.electron_electron_engine(),
+        .scf_mode = info.scf_mode(),
+        .cholesky_threshold = info.cholesky_threshold(),
+        .diis_start_iteration = info.diis_start_iteration(),
+        .diis_history_length = info.diis_history_length(),
+        .checkpoint_path = info.checkpoint_file(),
+        .checkpoint_period = info.checkpoint_period(),
+        .restart_from_checkpoint = info.restart_from_checkpoint()
+    };
+}
+
+auto batch_input_files(const std::filesystem::path& directory_or_manifest) -> std::vector<std::filesystem::path>
+{
+    auto input_paths = std::vector<std::filesystem::path> {};
+
+    if (std::filesystem::is_directory(directory_or_manifest)) {
+        for (const auto& entry : std::filesystem::directory_iterator {directory_or_manifest}) {
+            if (entry.is_regular_file() && entry.path().extension() == ".toml") {
+                input_paths.push_back(entry.path());
+            }
+        }
+
+        std::sort(input_paths.begin(), input_paths.end());
+
+        return input_paths;
+    }
+
+    auto manifest_stream = std::ifstream {directory_or_manifest};
+    if (!manifest_stream.is_open()) {
+        throw std::runtime_error {"Failed to open the batch manifest '" + directory_or_manifest.string() + "'."};
+    }
+
+    const auto manifest_directory = directory_or_manifest.parent_path();
+
+    auto line = std::string {};
+    while (std::getline(manifest_stream, line)) {
+        const auto entry = trimmed(line);
+        if (entry.empty() || entry.front() == '#') {
+            continue;
+        }
+
+        const auto path = std::filesystem::path {entry};
+        input_paths.push_back(path.is_absolute() ? path : manifest_directory / path);
+    }
+
+    return input_paths;
+}
+
+auto format_batch_job_result(const BatchJobResult& result) -> std::string
+{
+    auto line = std::stringstream {};
+    line << result.input_path.string() << '\t' << status_name(result.status) << '\t';
+    line << std::fixed << std::setprecision(12) << result.total_energy << '\t';
+    line << result.n_iterations << '\t';
+    line << std::setprecision(3) << result.seconds;
+
+    if (result.status == BatchJobStatus::FAILED) {
+        line << '\t' << result.error_message;
+    }
+
+    return line.str();
+}
+
+auto run_batch(
+    const std::vector<std::filesystem::path>& input_paths,
+    const BatchOptions& options,
+    std::ostream& results_output
+) -> std::vector<BatchJobResult>
+{
+    if (options.n_threads_per_job == 0) {
+        throw std::runtime_error {"Each job in a batch needs at least one thread."};
+    }
+
+    if (options.log_directory) {
+        std::filesystem::create_directories(*options.log_directory);
+    }
+
+    const auto n_jobs = input_paths.size();
+    auto results = std::vector<BatchJobResult>(n_jobs);
+    auto prepared_jobs = std::vector<std::optional<PreparedJob>>(n_jobs);
+    auto start_times = std::vector<Clock::time_point>(n_jobs);
+
+    auto results_mutex = std::mutex {};
+    const auto finish_job = [&](std::size_t i_job, BatchJobResult result)
+    {
+        result.seconds = seconds_since(start_times[i_job]);
+
+        const auto lock = std::scoped_lock {results_mutex};
+        results_output << format_batch_job_result(result) << std::endl;
+        results[i_job] = std::move(result);
+    };
+
+    const auto fail_job = [&](std::size_t i_job, const std::string& message)
+    { finish_job(i_job, {input_paths[i_job], BatchJobStatus::FAILED, 0, 0.0, 0.0, message}); };
+
+    const auto prepare = [&](std::size_t i_job)
+    {
+        // a job that fails to prepare reports the time it spent reading its input file
+        start_times[i_job] = Clock::now();
+
+        try {
+            prepared_jobs[i_job] = prepare_job(input_paths[i_job], options.n_threads_per_job);
+        }
+        catch (const std::exception& error) {
+            fail_job(i_job, error.what());
+        }
+    };
+
+    const auto calculate = [&](std::size_t i_job)
+    {
+        // the reported time is that of the calculation alone; it does not include the parse pass, or the
+        // time the job spent waiting for a thread
+        start_times[i_job] = Clock::now();
+
+        auto& job = *prepared_jobs[i_job];
+
+        try {
+            auto log_stream = std::ofstream {};
+            if (options.log_directory) {
+                log_stream.open(log_file_path(*options.log_directory, input_paths[i_job], i_job));
+                job.options.output = &log_stream;
+            }
+            else {
+                job.options.output = nullptr;
+            }
+
+            const auto rhf = perform_restricted_hartree_fock(job.atoms, job.basis, job.options);
+            const auto status = rhf.is_converged ? BatchJobStatus::CONVERGED : BatchJobStatus::NOT_CONVERGED;
+
+            finish_job(i_job, {input_paths[i_job], status, rhf.n_iterations, rhf.total_energy, 0.0, ""});
+        }
+        catch (const std::exception& error) {
+            fail_job(i_job, error.what());
+        }
+
+        // the basis of a finished job is no longer needed
+        prepared_jobs[i_job].reset();
+    };
+
+    // reading the input files is cheap, but the cost of each calculation is only known once its input
+    // file has been read, so all of them are read first
+    auto preparation_tasks = std::vector<parallel::WeightedTask> {};
+    preparation_tasks.reserve(n_jobs);
+    for (std::size_t i_job {0}; i_job < n_jobs; ++i_job) {
+        preparation_tasks.push_back({1.0, [&prepare, i_job]() { prepare(i_job); }});
+    }
+
+    parallel::run_work_stealing(std::move(preparation_tasks), options.n_threads);
+
+    auto calculation_tasks = std::vector<parallel::WeightedTask> {};
+    for (std::size_t i_job {0}; i_job < n_jobs; ++i_job) {
+        if (prepared_jobs[i_job]) {
+            const auto cost = estimated_cost(*prepared_jobs[i_job]);
+            calculation_tasks.push_back({cost, [&calculate, i_job]() { calculate(i_job); }});
+        }
+    }
+
+    parallel::run_work_stealing(std::move(calculation_tasks), options.n_threads);
+
+    return results;
+}
+
+}  // namespace elec
@@ -15,9 +15,19 @@ the input for the electronic structure calculation.
 #include "elecstruct/input_file_parser/input_file_parser.hpp"
 
 #include "parse_atom_information.cpp"
+#include "parse_checkpoint_file.cpp"
+#include "parse_checkpoint_period.cpp"
+#include "parse_cholesky_threshold.cpp"
+#include "parse_diis_history_length.cpp"
+#include "parse_diis_start_iteration.cpp"
+#include "parse_electron_electron_engine.cpp"
 #include "parse_initial_fock_guess.cpp"
 #include "parse_max_hartree_fock_iterations.cpp"
 #include "parse_n_electrons.cpp"
+#include "parse_n_threads.cpp"
+#include "parse_restart_from_checkpoint.cpp"
+#include "parse_scf_mode.cpp"
+#include "parse_schwarz_screening_tolerance.cpp"
 #include "parse_tol_change_density_matrix.cpp"
 #include "parse_tol_change_hartree_fock_energy.cpp"
 #include "parse_verbose.cpp"
@@ -27,9 +37,7 @@ namespace elec
 
 InputFileParser::InputFileParser(std::istream& toml_stream)
     : table_ {parse_stream_to_table_(toml_stream)}
-{
-    parse_stream_to_table_(toml_stream);
-}
+{}
 
 auto InputFileParser::is_valid() const noexcept -> bool
 {
@@ -102,6 +110,46 @@ auto InputFileParser::parse(InputFileKey key) -> void
             parsed_information_[key] = parse_verbose(table);
             break;
         }
+        case IFK::SCHWARZ_SCREENING_TOLERANCE : {
+            parsed_information_[key] = parse_schwarz_screening_tolerance(table);
+            break;
+        }
+        case IFK::N_THREADS : {
+            parsed_information_[key] = parse_n_threads(table);
+            break;
+        }
+        case IFK::ELECTRON_ELECTRON_ENGINE : {
+            parsed_information_[key] = parse_electron_electron_engine(table);
+            break;
+        }
+        case IFK::SCF_MODE : {
+            parsed_information_[key] = parse_scf_mode(table);
+            break;
+        }
+        case IFK::CHOLESKY_THRESHOLD : {
+            parsed_information_[key] = parse_cholesky_threshold(table);
+            break;
+        }
+        case IFK::DIIS_START_ITERATION : {
+            parsed_information_[key] = parse_diis_start_iteration(table);
+            break;
+        }
+        case IFK::DIIS_HISTORY_LENGTH : {
+            parsed_information_[key] = parse_diis_history_length(table);
+            break;
+        }
+        case IFK::CHECKPOINT_FILE : {
+            parsed_information_[key] = parse_checkpoint_file(table);
+            break;
+        }
+        case IFK::CHECKPOINT_PERIOD : {
+            parsed_information_[key] = parse_checkpoint_period(table);
+            break;
+        }
+        case IFK::RESTART_FROM_CHECKPOINT : {
+            parsed_information_[key] = parse_restart_from_checkpoint(table);
+            break;
+        }
         default : {
             // unreachable; maybe upgrade to C++23 to get the unreachable attribute
         }
@@ -119,6 +167,16 @@ auto InputFileParser::parse_all() -> void
     // parse(IFK::TOL_CHANGE_HARTREE_FOCK_ENERGY);
     parse(IFK::N_ELECTRONS);
     parse(IFK::VERBOSE);
+    parse(IFK::SCHWARZ_SCREENING_TOLERANCE);
+    parse(IFK::N_THREADS);
+    parse(IFK::ELECTRON_ELECTRON_ENGINE);
+    parse(IFK::SCF_MODE);
+    parse(IFK::CHOLESKY_THRESHOLD);
+    parse(IFK::DIIS_START_ITERATION);
+    parse(IFK::DIIS_HISTORY_LENGTH);
+    parse(IFK::CHECKPOINT_FILE);
+    parse(IFK::CHECKPOINT_PERIOD);
+    parse(IFK::RESTART_FROM_CHECKPOINT);
 }
 
 auto InputFileParser::parsed_information() const -> const ParsedInformation&
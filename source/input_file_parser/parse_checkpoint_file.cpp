@@ -0,0 +1,33 @@
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include "extern/tomlplusplus/toml.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, no checkpoint file is written.
+*/
+auto parse_checkpoint_file(const toml::table& table) -> std::optional<std::filesystem::path>
+{
+    if (!table.contains("checkpoint_file")) {
+        return std::nullopt;
+    }
+
+    const auto path_toml = table["checkpoint_file"].as_string();
+    if (!path_toml) {
+        throw std::runtime_error {"Failed to parse 'checkpoint_file'\n"};
+    }
+
+    const auto path = *path_toml->value_exact<std::string>();
+
+    if (path.empty()) {
+        throw std::runtime_error {"'checkpoint_file' must not be empty\n"};
+    }
+
+    return std::filesystem::path {path};
+}
+
+}  // anonymous namespace
@@ -0,0 +1,33 @@
+#include <cstdint>
+
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, the default period is used.
+*/
+auto parse_checkpoint_period(const toml::table& table) -> std::size_t
+{
+    if (!table.contains("checkpoint_period")) {
+        return elec::DEFAULT_CHECKPOINT_PERIOD;
+    }
+
+    const auto period_toml = table["checkpoint_period"].as_integer();
+    if (!period_toml) {
+        throw std::runtime_error {"Failed to parse 'checkpoint_period'\n"};
+    }
+
+    const auto period = *period_toml->value_exact<std::int64_t>();
+
+    if (period <= 0) {
+        throw std::runtime_error {"'checkpoint_period' must be positive\n"};
+    }
+
+    return static_cast<std::size_t>(period);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,31 @@
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, the default threshold is used.
+*/
+auto parse_cholesky_threshold(const toml::table& table) -> double
+{
+    if (!table.contains("cholesky_threshold")) {
+        return elec::DEFAULT_CHOLESKY_THRESHOLD;
+    }
+
+    const auto threshold_toml = table["cholesky_threshold"].as_floating_point();
+    if (!threshold_toml) {
+        throw std::runtime_error {"Failed to parse 'cholesky_threshold'\n"};
+    }
+
+    const auto threshold = *threshold_toml->value_exact<double>();
+
+    if (threshold < 0.0) {
+        throw std::runtime_error {"'cholesky_threshold' must be non-negative\n"};
+    }
+
+    return threshold;
+}
+
+}  // anonymous namespace
@@ -0,0 +1,34 @@
+#include <cstdint>
+
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, the default history length is used. A history
+    length of zero turns DIIS off.
+*/
+auto parse_diis_history_length(const toml::table& table) -> std::size_t
+{
+    if (!table.contains("diis_history_length")) {
+        return elec::DEFAULT_DIIS_HISTORY_LENGTH;
+    }
+
+    const auto length_toml = table["diis_history_length"].as_integer();
+    if (!length_toml) {
+        throw std::runtime_error {"Failed to parse 'diis_history_length'\n"};
+    }
+
+    const auto length = *length_toml->value_exact<std::int64_t>();
+
+    if (length < 0) {
+        throw std::runtime_error {"'diis_history_length' must be non-negative\n"};
+    }
+
+    return static_cast<std::size_t>(length);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,33 @@
+#include <cstdint>
+
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, DIIS starts at the default iteration.
+*/
+auto parse_diis_start_iteration(const toml::table& table) -> std::size_t
+{
+    if (!table.contains("diis_start_iteration")) {
+        return elec::DEFAULT_DIIS_START_ITERATION;
+    }
+
+    const auto start_toml = table["diis_start_iteration"].as_integer();
+    if (!start_toml) {
+        throw std::runtime_error {"Failed to parse 'diis_start_iteration'\n"};
+    }
+
+    const auto start = *start_toml->value_exact<std::int64_t>();
+
+    if (start <= 0) {
+        throw std::runtime_error {"'diis_start_iteration' must be positive\n"};
+    }
+
+    return static_cast<std::size_t>(start);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,54 @@
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#include "extern/mapbox/eternal.hpp"
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+using estr = mapbox::eternal::string;
+using EEE = elec::ElectronElectronEngine;
+
+constexpr auto map_string_to_electron_electron_engine = mapbox::eternal::map<estr, EEE>({
+    {"cook",              EEE::COOK             },
+    {"head_gordon_pople", EEE::HEAD_GORDON_POPLE},
+    {"rys",               EEE::RYS              },
+    {"specialized",       EEE::SPECIALIZED      }
+});
+
+/*
+    This option is not required; if it is missing, the default engine is used.
+*/
+auto parse_electron_electron_engine(const toml::table& table) -> EEE
+{
+    if (!table.contains("electron_electron_engine")) {
+        return elec::DEFAULT_ELECTRON_ELECTRON_ENGINE;
+    }
+
+    const auto engine_string = table["electron_electron_engine"].as_string();
+    if (!engine_string) {
+        throw std::runtime_error {"Failed to parse 'electron_electron_engine'\n"};
+    }
+
+    const auto str = *engine_string->value_exact<std::string>();
+
+    if (map_string_to_electron_electron_engine.find(str.c_str()) == map_string_to_electron_electron_engine.end()) {
+        auto err_msg = std::stringstream {};
+        err_msg << "ERROR: Invalid choice of electron-electron engine.\n";
+        err_msg << "Allowed options: \n";
+        for (const auto& item : map_string_to_electron_electron_engine) {
+            err_msg << "  - " << item.first.c_str() << '\n';
+        }
+        err_msg << '\n';
+
+        throw std::runtime_error {err_msg.str()};
+    }
+
+    return map_string_to_electron_electron_engine.at(str.c_str());
+}
+
+}  // anonymous namespace
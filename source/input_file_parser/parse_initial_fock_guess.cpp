@@ -14,9 +14,10 @@ using estr = mapbox::eternal::string;
 using IFG = elec::InitialFockGuess;
 
 constexpr auto map_string_to_initial_fock_guess = mapbox::eternal::map<estr, IFG>({
-    {"zero",             IFG::ZERO_MATRIX            },
-    {"extended_huckel",  IFG::EXTENDED_HUCKEL_MATRIX },
-    {"core_hamiltonian", IFG::CORE_HAMILTONIAN_MATRIX}
+    {"zero",                              IFG::ZERO_MATRIX                      },
+    {"extended_huckel",                   IFG::EXTENDED_HUCKEL_MATRIX           },
+    {"core_hamiltonian",                  IFG::CORE_HAMILTONIAN_MATRIX          },
+    {"superposition_of_atomic_densities", IFG::SUPERPOSITION_OF_ATOMIC_DENSITIES}
 });
 
 auto parse_initial_fock_guess(const toml::table& table) -> IFG
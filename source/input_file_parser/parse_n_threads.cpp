@@ -0,0 +1,33 @@
+#include <cstdint>
+
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, the calculation runs on a single thread.
+*/
+auto parse_n_threads(const toml::table& table) -> std::size_t
+{
+    if (!table.contains("n_threads")) {
+        return elec::DEFAULT_N_THREADS;
+    }
+
+    const auto n_threads_toml = table["n_threads"].as_integer();
+    if (!n_threads_toml) {
+        throw std::runtime_error {"Failed to parse 'n_threads'\n"};
+    }
+
+    const auto n_threads = *n_threads_toml->value_exact<std::int64_t>();
+
+    if (n_threads <= 0) {
+        throw std::runtime_error {"'n_threads' must be positive\n"};
+    }
+
+    return static_cast<std::size_t>(n_threads);
+}
+
+}  // anonymous namespace
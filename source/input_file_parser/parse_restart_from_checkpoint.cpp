@@ -0,0 +1,23 @@
+#include "extern/tomlplusplus/toml.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, the calculation starts from scratch.
+*/
+auto parse_restart_from_checkpoint(const toml::table& table) -> bool
+{
+    if (!table.contains("restart_from_checkpoint")) {
+        return false;
+    }
+
+    const auto restart_toml = table["restart_from_checkpoint"].as_boolean();
+    if (!restart_toml) {
+        throw std::runtime_error {"Failed to parse 'restart_from_checkpoint'\n"};
+    }
+
+    return *restart_toml->value_exact<bool>();
+}
+
+}  // anonymous namespace
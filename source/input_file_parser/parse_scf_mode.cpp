@@ -0,0 +1,55 @@
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#include "extern/mapbox/eternal.hpp"
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+using estr = mapbox::eternal::string;
+using SM = elec::ScfMode;
+
+constexpr auto map_string_to_scf_mode = mapbox::eternal::map<estr, SM>({
+    {"conventional",    SM::CONVENTIONAL   },
+    {"direct",          SM::DIRECT         },
+    {"out_of_core",     SM::OUT_OF_CORE    },
+    {"density_fitting", SM::DENSITY_FITTING},
+    {"cholesky",        SM::CHOLESKY       }
+});
+
+/*
+    This option is not required; if it is missing, the integrals are stored in memory.
+*/
+auto parse_scf_mode(const toml::table& table) -> SM
+{
+    if (!table.contains("scf_mode")) {
+        return elec::DEFAULT_SCF_MODE;
+    }
+
+    const auto mode_string = table["scf_mode"].as_string();
+    if (!mode_string) {
+        throw std::runtime_error {"Failed to parse 'scf_mode'\n"};
+    }
+
+    const auto str = *mode_string->value_exact<std::string>();
+
+    if (map_string_to_scf_mode.find(str.c_str()) == map_string_to_scf_mode.end()) {
+        auto err_msg = std::stringstream {};
+        err_msg << "ERROR: Invalid choice of SCF mode.\n";
+        err_msg << "Allowed options: \n";
+        for (const auto& item : map_string_to_scf_mode) {
+            err_msg << "  - " << item.first.c_str() << '\n';
+        }
+        err_msg << '\n';
+
+        throw std::runtime_error {err_msg.str()};
+    }
+
+    return map_string_to_scf_mode.at(str.c_str());
+}
+
+}  // anonymous namespace
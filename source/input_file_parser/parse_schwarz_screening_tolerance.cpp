@@ -0,0 +1,31 @@
+#include "extern/tomlplusplus/toml.hpp"
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+
+namespace
+{
+
+/*
+    This option is not required; if it is missing, the default tolerance is used.
+*/
+auto parse_schwarz_screening_tolerance(const toml::table& table) -> double
+{
+    if (!table.contains("schwarz_screening_tolerance")) {
+        return elec::DEFAULT_SCHWARZ_SCREENING_TOLERANCE;
+    }
+
+    const auto tolerance_toml = table["schwarz_screening_tolerance"].as_floating_point();
+    if (!tolerance_toml) {
+        throw std::runtime_error {"Failed to parse 'schwarz_screening_tolerance'\n"};
+    }
+
+    const auto tolerance = *tolerance_toml->value_exact<double>();
+
+    if (tolerance < 0.0) {
+        throw std::runtime_error {"'schwarz_screening_tolerance' must be non-negative\n"};
+    }
+
+    return tolerance;
+}
+
+}  // anonymous namespace
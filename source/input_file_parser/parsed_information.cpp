@@ -98,4 +98,124 @@ auto ParsedInformation::verbose() const -> Verbose
     return std::any_cast<T>(info_.at(key));
 }
 
+auto ParsedInformation::schwarz_screening_tolerance() const -> double
+{
+    using T = double;
+    const auto key = InputFileKey::SCHWARZ_SCREENING_TOLERANCE;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'schwarz_screening_tolerance' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::n_threads() const -> std::size_t
+{
+    using T = std::size_t;
+    const auto key = InputFileKey::N_THREADS;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'n_threads' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::electron_electron_engine() const -> ElectronElectronEngine
+{
+    using T = ElectronElectronEngine;
+    const auto key = InputFileKey::ELECTRON_ELECTRON_ENGINE;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'electron_electron_engine' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::scf_mode() const -> ScfMode
+{
+    using T = ScfMode;
+    const auto key = InputFileKey::SCF_MODE;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'scf_mode' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::cholesky_threshold() const -> double
+{
+    using T = double;
+    const auto key = InputFileKey::CHOLESKY_THRESHOLD;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'cholesky_threshold' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::diis_start_iteration() const -> std::size_t
+{
+    using T = std::size_t;
+    const auto key = InputFileKey::DIIS_START_ITERATION;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'diis_start_iteration' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::diis_history_length() const -> std::size_t
+{
+    using T = std::size_t;
+    const auto key = InputFileKey::DIIS_HISTORY_LENGTH;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'diis_history_length' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::checkpoint_file() const -> std::optional<std::filesystem::path>
+{
+    using T = std::optional<std::filesystem::path>;
+    const auto key = InputFileKey::CHECKPOINT_FILE;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'checkpoint_file' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::checkpoint_period() const -> std::size_t
+{
+    using T = std::size_t;
+    const auto key = InputFileKey::CHECKPOINT_PERIOD;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'checkpoint_period' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
+auto ParsedInformation::restart_from_checkpoint() const -> bool
+{
+    using T = bool;
+    const auto key = InputFileKey::RESTART_FROM_CHECKPOINT;
+
+    if (info_.find(key) == info_.end()) {
+        throw std::runtime_error {"ERROR: 'restart_from_checkpoint' has not been parsed."};
+    }
+
+    return std::any_cast<T>(info_.at(key));
+}
+
 }  // namespace elec
@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <span>
 #include <stdexcept>
 
 #include "elecstruct/integrals/boys.hpp"
@@ -17,7 +20,7 @@
 namespace
 {
 
-constexpr auto BOYS_ORDER_UPPER_BOUND_ = std::size_t {13};
+constexpr auto BOYS_ORDER_UPPER_BOUND_ = elec::BOYS_MAX_ORDER + 1;
 
 constexpr auto LARGE_CUTOFF_ = double {0.45425955121971775e01};
 constexpr auto LARGE_SQRT_PI_O_2_ = double {0.886226925452758014};
@@ -82,31 +85,21 @@ constexpr auto WW_DATA_ = std::array<std::complex<double>, 10> {
 };
 
 /*
-    NOTE: the check to make sure that n <= 12 should be done outside of this function.
+    Fill in the orders 0 through `n_max` using upward recursion.
+
+    NOTE: the check to make sure that n_max <= 12 should be done outside of this function.
 */
-auto boys_fast_large_(double x, std::size_t n) -> double
+void boys_fast_large_(double x, std::size_t n_max, std::span<double> values)
 {
     const auto halfy = std::exp(-x) / 2.0;
     const auto yy = std::sqrt(x);
 
-    std::array<double, BOYS_ORDER_UPPER_BOUND_> values;
     values[0] = LARGE_SQRT_PI_O_2_ * std::erf(yy) / yy;
 
-    if (n == 0) {
-        return values[0];
-    }
-
-    for (std::size_t i {1}; i < BOYS_ORDER_UPPER_BOUND_; ++i) {
+    for (std::size_t i {1}; i <= n_max; ++i) {
         const auto i_shifted = static_cast<double>(i) - 0.5;
         values[i] = (i_shifted * values[i - 1] - halfy) / x;
-        if (i == n) {
-            return values[i];
-        }
     }
-
-    // technically this function only accepts 0 <= n <= constants::BOYS_ORDER_UPPER_BOUND_, and
-    // so should return from the loop; but the compiler raises a warning if we don't write this
-    return values[BOYS_ORDER_UPPER_BOUND_ - 1];
 }
 
 auto boys_fast_small_rtmp_(double x, double y) -> double
@@ -138,37 +131,31 @@ auto boys_fast_small_tmp_(double x, double y) -> double
     }
 }
 
-auto boys_fast_small_(double x, std::size_t n) -> double
+/*
+    Fill in the orders 0 through `n_max` using downward recursion from order 12; the orders above
+    `n_max` are still needed as intermediate values, so they are kept in a local buffer.
+*/
+void boys_fast_small_(double x, std::size_t n_max, std::span<double> values)
 {
     const auto y = std::exp(-x);
     const auto rtmp = boys_fast_small_rtmp_(x, y);
     const auto tmp = boys_fast_small_tmp_(x, y);
 
-    std::array<double, BOYS_ORDER_UPPER_BOUND_> values;
-    values[12] = 2.0 * rtmp + tmp;
+    std::array<double, BOYS_ORDER_UPPER_BOUND_> all_values;
+    all_values[12] = 2.0 * rtmp + tmp;
 
-    if (n == 12) {
-        return values[12];
-    }
-    else {
-        const auto halfy = y / 2.0;
-
-        // need to do an index shift because the terminating condition ends up with i == -1,
-        // but `i` is an instance of `std::size_t`
-        //
-        // for (std::size_t i {11}; i >= 0; --i) {
-        for (std::size_t j {12}; j >= 1; --j) {
-            std::size_t i = j - 1;
-            values[i] = (x * values[i + 1] + halfy) * T_DATA_[i];
-            if (i == n) {
-                return values[i];
-            }
-        }
-
-        // technically this function only accepts 0 <= n <= constants::BOYS_ORDER_UPPER_BOUND_, and
-        // so should return from the loop; but the compiler raises a warning if we don't write this
-        return values[0];
+    const auto halfy = y / 2.0;
+
+    // need to do an index shift because the terminating condition ends up with i == -1,
+    // but `i` is an instance of `std::size_t`
+    //
+    // for (std::size_t i {11}; i >= 0; --i) {
+    for (std::size_t j {12}; j >= 1; --j) {
+        std::size_t i = j - 1;
+        all_values[i] = (x * all_values[i + 1] + halfy) * T_DATA_[i];
     }
+
+    std::copy(all_values.begin(), all_values.begin() + static_cast<std::ptrdiff_t>(n_max + 1), values.begin());
 }
 
 }  // anonymous namespace
@@ -178,15 +165,27 @@ namespace elec
 
 auto boys_beylkin_sharma(double x, std::size_t n) -> double
 {
-    if (n >= BOYS_ORDER_UPPER_BOUND_) {
+    auto values = std::array<double, BOYS_ORDER_UPPER_BOUND_> {};
+    boys_all_orders(x, n, values);
+
+    return values[n];
+}
+
+void boys_all_orders(double x, std::size_t n_max, std::span<double> values)
+{
+    if (n_max >= BOYS_ORDER_UPPER_BOUND_) {
         throw std::runtime_error {"This implementation only works for the Boys function up to and including order 12."};
     }
 
+    if (values.size() <= n_max) {
+        throw std::runtime_error {"The buffer for the Boys function values is too small for the requested orders."};
+    }
+
     if (std::fabs(x) >= LARGE_CUTOFF_) {
-        return boys_fast_large_(x, n);
+        boys_fast_large_(x, n_max, values);
     }
     else {
-        return boys_fast_small_(x, n);
+        boys_fast_small_(x, n_max, values);
     }
 }
 
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "elecstruct/integrals/boys.hpp"
+
+#include "elecstruct/integrals/boys_tabulated.hpp"
+
+namespace
+{
+
+constexpr auto GRID_SPACING_ = double {0.1};
+constexpr auto INV_GRID_SPACING_ = double {10.0};
+
+// the grid points run from x = 0 up to and including the cutoff
+constexpr auto N_GRID_POINTS_ = static_cast<std::size_t>(elec::BOYS_TABULATED_LARGE_CUTOFF * INV_GRID_SPACING_) + 1;
+
+// with |d| <= 0.05, the first neglected term of the Taylor series is below 1.0e-15 times F_n
+constexpr auto N_TAYLOR_TERMS_ = std::size_t {8};
+constexpr auto N_TABULATED_ORDERS_ = elec::BOYS_MAX_ORDER + N_TAYLOR_TERMS_;
+
+constexpr auto INV_INTEGERS_ = std::array<double, N_TAYLOR_TERMS_> {
+    0.0, 1.0, 1.0 / 2.0, 1.0 / 3.0, 1.0 / 4.0, 1.0 / 5.0, 1.0 / 6.0, 1.0 / 7.0};
+
+constexpr auto SQRT_PI_O_2_ = double {0.886226925452758014};
+
+/*
+    The highest tabulated order is found from its power series
+
+        F_n(x) = exp(-x) sum_k (2x)^k / [(2n + 1)(2n + 3) ... (2n + 2k + 1)]
+
+    whose terms are all positive, and the lower orders follow from the downward recursion, which is
+    stable. This is only done when building the grid, so speed is not a concern.
+*/
+auto boys_grid_row_(double x) -> std::array<double, N_TABULATED_ORDERS_>
+{
+    constexpr auto SERIES_TOLERANCE = double {1.0e-17};
+    constexpr auto N_MAX_SERIES_TERMS = std::size_t {1000};
+
+    const auto n_top = static_cast<double>(N_TABULATED_ORDERS_ - 1);
+
+    auto term = 1.0 / (2.0 * n_top + 1.0);
+    auto series = term;
+    for (std::size_t k {1}; k < N_MAX_SERIES_TERMS; ++k) {
+        term *= 2.0 * x / (2.0 * n_top + 2.0 * static_cast<double>(k) + 1.0);
+        series += term;
+
+        if (term < SERIES_TOLERANCE * series) {
+            break;
+        }
+    }
+
+    const auto exp_neg_x = std::exp(-x);
+
+    auto row = std::array<double, N_TABULATED_ORDERS_> {};
+    row[N_TABULATED_ORDERS_ - 1] = exp_neg_x * series;
+
+    for (std::size_t n {N_TABULATED_ORDERS_ - 1}; n >= 1; --n) {
+        row[n - 1] = (2.0 * x * row[n] + exp_neg_x) / (2.0 * static_cast<double>(n) - 1.0);
+    }
+
+    return row;
+}
+
+/*
+    The Boys functions at grid point `i` are stored contiguously, in order of increasing order.
+*/
+auto make_boys_grid_() -> std::vector<double>
+{
+    auto grid = std::vector<double>(N_GRID_POINTS_ * N_TABULATED_ORDERS_);
+
+    for (std::size_t i {0}; i < N_GRID_POINTS_; ++i) {
+        const auto row = boys_grid_row_(static_cast<double>(i) * GRID_SPACING_);
+        std::copy(row.begin(), row.end(), grid.begin() + static_cast<std::ptrdiff_t>(i * N_TABULATED_ORDERS_));
+    }
+
+    return grid;
+}
+
+auto boys_grid_() -> const std::vector<double>&
+{
+    static const auto grid = make_boys_grid_();
+    return grid;
+}
+
+/*
+    The index of the grid point closest to `x`; arguments past the end of the grid are clamped to
+    the last grid point, so that the result can always be used to index into the grid.
+
+    The clamping happens before the conversion to an integer, which would overflow for very large
+    arguments; `std::fmax()` also sends a NaN argument to the first grid point.
+*/
+auto nearest_grid_index_(double x) noexcept -> std::size_t
+{
+    const auto clamped_x = std::fmin(std::fmax(x, 0.0), elec::BOYS_TABULATED_LARGE_CUTOFF);
+    const auto index = static_cast<std::size_t>(clamped_x * INV_GRID_SPACING_ + 0.5);
+
+    return std::min(index, N_GRID_POINTS_ - 1);
+}
+
+/*
+    The Taylor expansion of order `n` about the grid point whose row starts at `row`, evaluated using
+    Horner's method.
+*/
+auto boys_taylor_(const double* row, std::size_t n, double displacement) noexcept -> double
+{
+    auto value = row[n + N_TAYLOR_TERMS_ - 1];
+    for (std::size_t k {N_TAYLOR_TERMS_ - 1}; k >= 1; --k) {
+        value = row[n + k - 1] - value * displacement * INV_INTEGERS_[k];
+    }
+
+    return value;
+}
+
+/*
+    Fill in the orders 0 through `n_max` for an argument above the cutoff, using upward recursion.
+*/
+void boys_large_(double x, std::size_t n_max, std::span<double> values)
+{
+    const auto exp_neg_x = std::exp(-x);
+    const auto inv_2x = 0.5 / x;
+
+    values[0] = SQRT_PI_O_2_ / std::sqrt(x);
+    for (std::size_t n {1}; n <= n_max; ++n) {
+        values[n] = ((2.0 * static_cast<double>(n) - 1.0) * values[n - 1] - exp_neg_x) * inv_2x;
+    }
+}
+
+void check_order_(std::size_t n)
+{
+    if (n > elec::BOYS_MAX_ORDER) {
+        throw std::runtime_error {"This implementation only works for the Boys function up to and including order 12."};
+    }
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto boys_tabulated(double x, std::size_t n) -> double
+{
+    check_order_(n);
+
+    if (x >= BOYS_TABULATED_LARGE_CUTOFF) {
+        auto values = std::array<double, BOYS_MAX_ORDER + 1> {};
+        boys_large_(x, n, values);
+
+        return values[n];
+    }
+
+    const auto index = nearest_grid_index_(x);
+    const auto displacement = x - static_cast<double>(index) * GRID_SPACING_;
+    const auto* row = boys_grid_().data() + index * N_TABULATED_ORDERS_;
+
+    return boys_taylor_(row, n, displacement);
+}
+
+void boys_all_orders_tabulated(double x, std::size_t n_max, std::span<double> values)
+{
+    check_order_(n_max);
+
+    if (values.size() <= n_max) {
+        throw std::runtime_error {"The buffer for the Boys function values is too small for the requested orders."};
+    }
+
+    if (x >= BOYS_TABULATED_LARGE_CUTOFF) {
+        boys_large_(x, n_max, values);
+        return;
+    }
+
+    const auto index = nearest_grid_index_(x);
+    const auto displacement = x - static_cast<double>(index) * GRID_SPACING_;
+    const auto* row = boys_grid_().data() + index * N_TABULATED_ORDERS_;
+
+    // the Horner steps are interleaved across the orders, so that the inner loop is over contiguous
+    // elements of the row
+    for (std::size_t n {0}; n <= n_max; ++n) {
+        values[n] = row[n + N_TAYLOR_TERMS_ - 1];
+    }
+
+    for (std::size_t k {N_TAYLOR_TERMS_ - 1}; k >= 1; --k) {
+        const auto factor = displacement * INV_INTEGERS_[k];
+        for (std::size_t n {0}; n <= n_max; ++n) {
+            values[n] = row[n + k - 1] - values[n] * factor;
+        }
+    }
+}
+
+void boys_tabulated_batch(std::span<const double> xs, std::size_t n, std::span<double> values)
+{
+    check_order_(n);
+
+    if (xs.size() != values.size()) {
+        throw std::runtime_error {"The number of Boys function arguments and output values must match."};
+    }
+
+    const auto* grid = boys_grid_().data();
+
+    // every argument goes through the grid first, with those above the cutoff clamped to the end
+    // of the grid; this keeps the loop free of branches
+    for (std::size_t i {0}; i < xs.size(); ++i) {
+        const auto index = nearest_grid_index_(xs[i]);
+        const auto displacement = xs[i] - static_cast<double>(index) * GRID_SPACING_;
+
+        values[i] = boys_taylor_(grid + index * N_TABULATED_ORDERS_, n, displacement);
+    }
+
+    // the results for the arguments above the cutoff are then overwritten
+    auto large_values = std::array<double, BOYS_MAX_ORDER + 1> {};
+    for (std::size_t i {0}; i < xs.size(); ++i) {
+        if (xs[i] >= BOYS_TABULATED_LARGE_CUTOFF) {
+            boys_large_(xs[i], n, large_values);
+            values[i] = large_values[n];
+        }
+    }
+}
+
+}  // namespace elec
@@ -0,0 +1,139 @@
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+#include "elecstruct/integrals/cholesky_decomposition.hpp"
+
+namespace
+{
+
+struct IndexPair
+{
+    std::size_t i0;
+    std::size_t i1;
+};
+
+/*
+    The unique index pairs (i0, i1) with i0 >= i1, in compound index order.
+*/
+auto unique_index_pairs(std::size_t n_basis_functions) -> std::vector<IndexPair>
+{
+    auto pairs = std::vector<IndexPair> {};
+    pairs.reserve(n_basis_functions * (n_basis_functions + 1) / 2);
+
+    for (std::size_t i0 {0}; i0 < n_basis_functions; ++i0) {
+        for (std::size_t i1 {0}; i1 <= i0; ++i1) {
+            pairs.push_back({i0, i1});
+        }
+    }
+
+    return pairs;
+}
+
+/*
+    Lays the Cholesky vectors, which are stored over the unique pairs, out as the N x (N M) matrix
+    expected by `FactorizedTwoElectronIntegrals`.
+*/
+auto expand_cholesky_vectors(
+    const std::vector<Eigen::VectorXd>& cholesky_vectors,
+    const std::vector<IndexPair>& pairs,
+    std::size_t n_basis_functions
+) -> Eigen::MatrixXd
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions);
+    const auto n_vectors = static_cast<Eigen::Index>(cholesky_vectors.size());
+
+    auto output = Eigen::MatrixXd {size, size * n_vectors};
+
+    for (Eigen::Index i_vec {0}; i_vec < n_vectors; ++i_vec) {
+        const auto& vector = cholesky_vectors[static_cast<std::size_t>(i_vec)];
+        const auto offset = i_vec * size;
+
+        for (std::size_t i_pair {0}; i_pair < pairs.size(); ++i_pair) {
+            const auto i0 = static_cast<Eigen::Index>(pairs[i_pair].i0);
+            const auto i1 = static_cast<Eigen::Index>(pairs[i_pair].i1);
+            const auto value = vector(static_cast<Eigen::Index>(i_pair));
+
+            output(i0, offset + i1) = value;
+            output(i1, offset + i0) = value;
+        }
+    }
+
+    return output;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto cholesky_decomposed_integrals(const ShellPairData& shell_pairs, double threshold, ElectronElectronEngine engine)
+    -> FactorizedTwoElectronIntegrals
+{
+    if (threshold < 0.0) {
+        throw std::runtime_error {"The threshold of the Cholesky decomposition must be non-negative."};
+    }
+
+    const auto n_basis_functions = shell_pairs.n_basis_functions();
+    const auto pairs = unique_index_pairs(n_basis_functions);
+    const auto n_pairs = static_cast<Eigen::Index>(pairs.size());
+
+    const auto integral = [&](Eigen::Index i_pair0, Eigen::Index i_pair1)
+    {
+        const auto& pair0 = pairs[static_cast<std::size_t>(i_pair0)];
+        const auto& pair1 = pairs[static_cast<std::size_t>(i_pair1)];
+        const auto& bra = shell_pairs.get(pair0.i0, pair0.i1);
+        const auto& ket = shell_pairs.get(pair1.i0, pair1.i1);
+
+        return electron_electron_integral(bra, ket, engine);
+    };
+
+    auto diagonal = Eigen::VectorXd {n_pairs};
+    for (Eigen::Index i_pair {0}; i_pair < n_pairs; ++i_pair) {
+        diagonal(i_pair) = integral(i_pair, i_pair);
+    }
+
+    auto cholesky_vectors = std::vector<Eigen::VectorXd> {};
+
+    while (static_cast<Eigen::Index>(cholesky_vectors.size()) < n_pairs) {
+        auto i_pivot = Eigen::Index {0};
+        const auto max_diagonal = diagonal.maxCoeff(&i_pivot);
+
+        if (max_diagonal <= threshold) {
+            break;
+        }
+
+        auto column = Eigen::VectorXd {n_pairs};
+        for (Eigen::Index i_pair {0}; i_pair < n_pairs; ++i_pair) {
+            column(i_pair) = integral(i_pair, i_pivot);
+        }
+
+        for (const auto& previous : cholesky_vectors) {
+            column -= previous(i_pivot) * previous;
+        }
+
+        column /= std::sqrt(max_diagonal);
+
+        diagonal -= column.cwiseAbs2();
+
+        // the pivot is now exactly represented; roundoff must not let it be picked again
+        diagonal(i_pivot) = 0.0;
+
+        cholesky_vectors.push_back(std::move(column));
+    }
+
+    auto vectors = expand_cholesky_vectors(cholesky_vectors, pairs, n_basis_functions);
+
+    return FactorizedTwoElectronIntegrals {n_basis_functions, std::move(vectors)};
+}
+
+}  // namespace elec
@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/basis/auxiliary_basis.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+#include "elecstruct/integrals/density_fitting.hpp"
+
+namespace
+{
+
+auto make_auxiliary_shell_pairs(const std::vector<elec::AuxiliaryFunctionInfo>& aux_basis)
+    -> std::vector<elec::ShellPair>
+{
+    auto aux_pairs = std::vector<elec::ShellPair> {};
+    aux_pairs.reserve(aux_basis.size());
+
+    for (const auto& function : aux_basis) {
+        aux_pairs.push_back(elec::make_auxiliary_shell_pair(function));
+    }
+
+    return aux_pairs;
+}
+
+/*
+    The two-centre integrals V(P, Q) = (P|Q).
+*/
+auto metric_matrix(const std::vector<elec::ShellPair>& aux_pairs, elec::ElectronElectronEngine engine)
+    -> Eigen::MatrixXd
+{
+    const auto n_aux = static_cast<Eigen::Index>(aux_pairs.size());
+    auto output = Eigen::MatrixXd {n_aux, n_aux};
+
+    for (Eigen::Index i_p {0}; i_p < n_aux; ++i_p) {
+        for (Eigen::Index i_q {0}; i_q <= i_p; ++i_q) {
+            const auto& pair_p = aux_pairs[static_cast<std::size_t>(i_p)];
+            const auto& pair_q = aux_pairs[static_cast<std::size_t>(i_q)];
+            const auto integral = elec::electron_electron_integral(pair_p, pair_q, engine);
+
+            output(i_p, i_q) = integral;
+            output(i_q, i_p) = integral;
+        }
+    }
+
+    return output;
+}
+
+/*
+    The three-centre integrals (P|i0 i1), laid out as an N x (N Naux) matrix, where the P-th block
+    of N columns holds the N x N matrix of (P|i0 i1).
+*/
+auto three_centre_integrals(
+    const elec::ShellPairData& shell_pairs,
+    const std::vector<elec::ShellPair>& aux_pairs,
+    elec::ElectronElectronEngine engine
+) -> Eigen::MatrixXd
+{
+    const auto size = static_cast<Eigen::Index>(shell_pairs.n_basis_functions());
+    const auto n_aux = static_cast<Eigen::Index>(aux_pairs.size());
+
+    auto output = Eigen::MatrixXd {size, size * n_aux};
+
+    for (Eigen::Index i_p {0}; i_p < n_aux; ++i_p) {
+        const auto& pair_p = aux_pairs[static_cast<std::size_t>(i_p)];
+        const auto offset = i_p * size;
+
+        for (Eigen::Index i0 {0}; i0 < size; ++i0) {
+            for (Eigen::Index i1 {0}; i1 <= i0; ++i1) {
+                const auto& pair_01 = shell_pairs.get(static_cast<std::size_t>(i0), static_cast<std::size_t>(i1));
+                const auto integral = elec::electron_electron_integral(pair_p, pair_01, engine);
+
+                output(i0, offset + i1) = integral;
+                output(i1, offset + i0) = integral;
+            }
+        }
+    }
+
+    return output;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto density_fitted_integrals(
+    const ShellPairData& shell_pairs,
+    const std::vector<AuxiliaryFunctionInfo>& aux_basis,
+    ElectronElectronEngine engine
+) -> FactorizedTwoElectronIntegrals
+{
+    const auto aux_pairs = make_auxiliary_shell_pairs(aux_basis);
+
+    const auto cholesky = Eigen::LLT<Eigen::MatrixXd> {metric_matrix(aux_pairs, engine)};
+    if (cholesky.info() != Eigen::Success) {
+        throw std::runtime_error {"The metric of the auxiliary basis is not positive definite."};
+    }
+
+    auto fitted_integrals = three_centre_integrals(shell_pairs, aux_pairs, engine);
+
+    // viewed as an N^2 x Naux matrix, the Q-th column holds (Q|i0 i1); multiplying from the right
+    // by L^-T = U^-1 mixes the columns into the fitted integrals B_P
+    const auto size = static_cast<Eigen::Index>(shell_pairs.n_basis_functions());
+    const auto n_aux = static_cast<Eigen::Index>(aux_basis.size());
+    auto columns = Eigen::Map<Eigen::MatrixXd> {fitted_integrals.data(), size * size, n_aux};
+    cholesky.matrixU().solveInPlace<Eigen::OnTheRight>(columns);
+
+    return FactorizedTwoElectronIntegrals {shell_pairs.n_basis_functions(), std::move(fitted_integrals)};
+}
+
+}  // namespace elec
@@ -1,12 +1,19 @@
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <stdexcept>
 
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/cartesian3d.hpp"
 #include "elecstruct/geometry.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
 #include "elecstruct/integrals/boys.hpp"
 #include "elecstruct/integrals/electron_electron_index_iterator.hpp"
 #include "elecstruct/integrals/f_coefficient.hpp"
-#include "elecstruct/mathtools/gaussian.hpp"
+#include "elecstruct/integrals/head_gordon_pople.hpp"
+#include "elecstruct/integrals/rys_quadrature.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/specialized_electron_electron_integrals.hpp"
 #include "elecstruct/mathtools/misc.hpp"
 #include "elecstruct/orbitals.hpp"
 
@@ -175,43 +182,38 @@ auto boys_index(
     return idx_l_sum - 2 * idx_r_sum - idx_i_sum;
 }
 
-}  // anonymous namespace
-
-namespace elec
-{
-
-auto electron_electron_integral_contraction(
-    const AngularMomentumNumbers& angmom_0,
-    const AngularMomentumNumbers& angmom_1,
-    const AngularMomentumNumbers& angmom_2,
-    const AngularMomentumNumbers& angmom_3,
-    const coord::Cartesian3D& pos_gauss0,
-    const coord::Cartesian3D& pos_gauss1,
-    const coord::Cartesian3D& pos_gauss2,
-    const coord::Cartesian3D& pos_gauss3,
-    double exponent0,
-    double exponent1,
-    double exponent2,
-    double exponent3
+/*
+    The two-electron integral between the primitive pairs `prim_01` and `prim_23`, without the
+    contraction coefficients and normalization constants.
+*/
+auto electron_electron_integral_primitive(
+    const elec::ShellPair& bra,
+    const elec::PrimitivePairData& prim_01,
+    const elec::ShellPair& ket,
+    const elec::PrimitivePairData& prim_23
 ) -> double
 {
-    const auto [pos_product_01, coeff_product_01] =
-        elec::math::gaussian_product(pos_gauss0, pos_gauss1, exponent0, exponent1);
-    const auto [pos_product_23, coeff_product_23] =
-        elec::math::gaussian_product(pos_gauss2, pos_gauss3, exponent2, exponent3);
+    using elec::AngularMomenta1D;
+    using elec::ElectronElectronIndexGenerator;
+
+    const auto& angmom_0 = bra.angmom0;
+    const auto& angmom_1 = bra.angmom1;
+    const auto& angmom_2 = ket.angmom0;
+    const auto& angmom_3 = ket.angmom1;
+    const auto& pos_gauss0 = bra.position0;
+    const auto& pos_gauss1 = bra.position1;
+    const auto& pos_gauss2 = ket.position0;
+    const auto& pos_gauss3 = ket.position1;
+    const auto& pos_product_01 = prim_01.product_centre;
+    const auto& pos_product_23 = prim_23.product_centre;
 
     // clang-format off
     const auto differences_x = make_position_differences(pos_gauss0.x, pos_gauss1.x, pos_gauss2.x, pos_gauss3.x, pos_product_01.x, pos_product_23.x);
     const auto differences_y = make_position_differences(pos_gauss0.y, pos_gauss1.y, pos_gauss2.y, pos_gauss3.y, pos_product_01.y, pos_product_23.y);
     const auto differences_z = make_position_differences(pos_gauss0.z, pos_gauss1.z, pos_gauss2.z, pos_gauss3.z, pos_product_01.z, pos_product_23.z);
 
-    const auto norm0 = elec::math::gaussian_norm(angmom_0, exponent0);
-    const auto norm1 = elec::math::gaussian_norm(angmom_1, exponent1);
-    const auto norm2 = elec::math::gaussian_norm(angmom_2, exponent2);
-    const auto norm3 = elec::math::gaussian_norm(angmom_3, exponent3);
-
-    const auto g_value_01 = exponent0 + exponent1;
-    const auto g_value_23 = exponent2 + exponent3;
+    const auto g_value_01 = prim_01.exponent_sum;
+    const auto g_value_23 = prim_23.exponent_sum;
     const auto delta = 0.25 * (1.0 / g_value_01 + 1.0 / g_value_23);
     const auto expon_info = GaussianExponentInfo {g_value_01, g_value_23, delta};
 
@@ -219,6 +221,15 @@ auto electron_electron_integral_contraction(
     const auto angmoms_y = AngularMomenta1D {angmom_0.y, angmom_1.y, angmom_2.y, angmom_3.y};
     const auto angmoms_z = AngularMomenta1D {angmom_0.z, angmom_1.z, angmom_2.z, angmom_3.z};
 
+    // the Boys function index can never exceed the total angular momentum of the quartet, and the argument
+    // is the same for every index; so all the orders that will be needed are calculated together up front
+    const auto boys_arg = 0.25 * coord::norm_squared(pos_product_01 - pos_product_23) / delta;
+    const auto boys_order_max = elec::total_angular_momentum(angmom_0) + elec::total_angular_momentum(angmom_1)
+                              + elec::total_angular_momentum(angmom_2) + elec::total_angular_momentum(angmom_3);
+
+    auto boys_values = std::array<double, elec::BOYS_MAX_ORDER + 1> {};
+    elec::boys_all_orders(boys_arg, static_cast<std::size_t>(boys_order_max), boys_values);
+
     auto integral = double {0.0};
 
     for (const auto indices_x : ElectronElectronIndexGenerator {angmoms_x}) {
@@ -240,9 +251,8 @@ auto electron_electron_integral_contraction(
                 }
 
                 const auto idx_boys = boys_index(indices_x, indices_y, indices_z);
-                const auto boys_arg = 0.25 * coord::norm_squared(pos_product_01 - pos_product_23) / delta;
-                const auto boys_factor = boys_beylkin_sharma(boys_arg, static_cast<std::size_t>(idx_boys));
-                
+                const auto boys_factor = boys_values[static_cast<std::size_t>(idx_boys)];
+
                 const auto contribution = b_factor_x * b_factor_y * b_factor_z * boys_factor;
                 integral += contribution;
             }
@@ -250,11 +260,87 @@ auto electron_electron_integral_contraction(
     }
     // clang-format on
 
-    const auto norm_tot = norm0 * norm1 * norm2 * norm3;
-    const auto coeff_tot = coeff_product_01 * coeff_product_23;
+    const auto coeff_tot = prim_01.prefactor * prim_23.prefactor;
     const auto expon_tot = 2.0 * M_PI * M_PI / (g_value_01 * g_value_23) * std::sqrt(M_PI / (g_value_01 + g_value_23));
 
-    return integral * coeff_tot * norm_tot * expon_tot;
+    return integral * coeff_tot * expon_tot;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto electron_electron_integral_contraction(
+    const AngularMomentumNumbers& angmom_0,
+    const AngularMomentumNumbers& angmom_1,
+    const AngularMomentumNumbers& angmom_2,
+    const AngularMomentumNumbers& angmom_3,
+    const coord::Cartesian3D& pos_gauss0,
+    const coord::Cartesian3D& pos_gauss1,
+    const coord::Cartesian3D& pos_gauss2,
+    const coord::Cartesian3D& pos_gauss3,
+    double exponent0,
+    double exponent1,
+    double exponent2,
+    double exponent3
+) -> double
+{
+    // the contraction coefficients are left as 1.0, so that only the normalization constants remain
+    // clang-format off
+    const auto prim_01 = make_primitive_pair_data(angmom_0, angmom_1, pos_gauss0, pos_gauss1, {1.0, exponent0}, {1.0, exponent1});
+    const auto prim_23 = make_primitive_pair_data(angmom_2, angmom_3, pos_gauss2, pos_gauss3, {1.0, exponent2}, {1.0, exponent3});
+    // clang-format on
+
+    const auto bra = ShellPair {angmom_0, angmom_1, pos_gauss0, pos_gauss1, {prim_01}};
+    const auto ket = ShellPair {angmom_2, angmom_3, pos_gauss2, pos_gauss3, {prim_23}};
+
+    return electron_electron_integral(bra, ket);
+}
+
+auto electron_electron_integral(const ShellPair& bra, const ShellPair& ket) -> double
+{
+    auto output = double {0.0};
+    for (const auto& prim_01 : bra.primitives) {
+        for (const auto& prim_23 : ket.primitives) {
+            const auto coeff = prim_01.coefficient * prim_23.coefficient;
+            output += coeff * electron_electron_integral_primitive(bra, prim_01, ket, prim_23);
+        }
+    }
+
+    return output;
+}
+
+auto electron_electron_integral(const ShellPair& bra, const ShellPair& ket, ElectronElectronEngine engine) -> double
+{
+    switch (engine) {
+        case ElectronElectronEngine::COOK : {
+            return electron_electron_integral(bra, ket);
+        }
+        case ElectronElectronEngine::HEAD_GORDON_POPLE : {
+            return electron_electron_integral_head_gordon_pople(bra, ket);
+        }
+        case ElectronElectronEngine::RYS : {
+            return electron_electron_integral_rys(bra, ket);
+        }
+        case ElectronElectronEngine::SPECIALIZED : {
+            return electron_electron_integral_specialized(bra, ket);
+        }
+        default : {
+            throw std::runtime_error {"UNREACHABLE: unknown ElectronElectronEngine passed to function!"};
+        }
+    }
+}
+
+// TODO: change coefficients of the integral so that they might be complex, since technically this is required
+auto electron_electron_integral(
+    const AtomicOrbitalInfoSTO3G& orbital0,
+    const AtomicOrbitalInfoSTO3G& orbital1,
+    const AtomicOrbitalInfoSTO3G& orbital2,
+    const AtomicOrbitalInfoSTO3G& orbital3
+) -> double
+{
+    return electron_electron_integral(make_shell_pair(orbital0, orbital1), make_shell_pair(orbital2, orbital3));
 }
 
 }  // namespace elec
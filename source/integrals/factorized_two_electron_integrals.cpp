@@ -0,0 +1,120 @@
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+
+namespace elec
+{
+
+FactorizedTwoElectronIntegrals::FactorizedTwoElectronIntegrals(std::size_t n_basis_functions, Eigen::MatrixXd vectors)
+    : n_basis_functions_ {n_basis_functions}
+    , n_vectors_ {0}
+    , vectors_ {std::move(vectors)}
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+
+    if (vectors_.rows() != size || (size > 0 && vectors_.cols() % size != 0)) {
+        throw std::runtime_error {"The factorized integrals do not match the number of basis functions."};
+    }
+
+    n_vectors_ = (size > 0) ? static_cast<std::size_t>(vectors_.cols() / size) : 0;
+}
+
+auto FactorizedTwoElectronIntegrals::coulomb_matrix(const Eigen::MatrixXd& density_mtx) const -> Eigen::MatrixXd
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+
+    auto output = Eigen::MatrixXd {size, size};
+    coulomb_matrix(output, density_mtx);
+
+    return output;
+}
+
+auto FactorizedTwoElectronIntegrals::exchange_matrix(const Eigen::MatrixXd& density_mtx) const -> Eigen::MatrixXd
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+
+    auto output = Eigen::MatrixXd {size, size};
+    exchange_matrix(output, density_mtx);
+
+    return output;
+}
+
+void FactorizedTwoElectronIntegrals::coulomb_matrix(
+    Eigen::MatrixXd& coulomb_mtx,
+    const Eigen::MatrixXd& density_mtx
+) const
+{
+    check_density_matrix_(density_mtx);
+    check_output_matrix_(coulomb_mtx);
+
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+    const auto n_vectors = static_cast<Eigen::Index>(n_vectors_);
+
+    // viewed as an N^2 x M matrix, the J-th column holds L_J
+    const auto columns = Eigen::Map<const Eigen::MatrixXd> {vectors_.data(), size * size, n_vectors};
+    const auto density_vec = Eigen::Map<const Eigen::VectorXd> {density_mtx.data(), size * size};
+
+    // gamma(J) = tr(L_J D), since both matrices are symmetric
+    const auto gamma = (columns.transpose() * density_vec).eval();
+
+    auto coulomb_vec = Eigen::Map<Eigen::VectorXd> {coulomb_mtx.data(), size * size};
+    coulomb_vec.noalias() = columns * gamma;
+}
+
+void FactorizedTwoElectronIntegrals::exchange_matrix(
+    Eigen::MatrixXd& exchange_mtx,
+    const Eigen::MatrixXd& density_mtx
+) const
+{
+    check_density_matrix_(density_mtx);
+    check_output_matrix_(exchange_mtx);
+
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+    const auto n_vectors = static_cast<Eigen::Index>(n_vectors_);
+
+    // every block D L_J at once, in a single product
+    const auto density_times_vectors = (density_mtx * vectors_).eval();
+
+    exchange_mtx.setZero();
+    for (Eigen::Index i_vec {0}; i_vec < n_vectors; ++i_vec) {
+        const auto offset = i_vec * size;
+        exchange_mtx.noalias() += vectors_.middleCols(offset, size) * density_times_vectors.middleCols(offset, size);
+    }
+}
+
+auto FactorizedTwoElectronIntegrals::vectors() const noexcept -> const Eigen::MatrixXd&
+{
+    return vectors_;
+}
+
+auto FactorizedTwoElectronIntegrals::n_basis_functions() const noexcept -> std::size_t
+{
+    return n_basis_functions_;
+}
+
+auto FactorizedTwoElectronIntegrals::n_vectors() const noexcept -> std::size_t
+{
+    return n_vectors_;
+}
+
+void FactorizedTwoElectronIntegrals::check_density_matrix_(const Eigen::MatrixXd& density_mtx) const
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+    if (density_mtx.rows() != size || density_mtx.cols() != size) {
+        throw std::runtime_error {"The density matrix does not match the number of basis functions."};
+    }
+}
+
+void FactorizedTwoElectronIntegrals::check_output_matrix_(const Eigen::MatrixXd& output_mtx) const
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+    if (output_mtx.rows() != size || output_mtx.cols() != size) {
+        throw std::runtime_error {"The output matrix does not match the number of basis functions."};
+    }
+}
+
+}  // namespace elec
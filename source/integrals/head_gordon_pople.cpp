@@ -0,0 +1,350 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/geometry.hpp"
+#include "elecstruct/integrals/boys.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "elecstruct/integrals/head_gordon_pople.hpp"
+
+namespace
+{
+
+/*
+    The Cartesian components (x, y, z) of every angular momentum up to and including some maximum
+    total angular momentum are stored contiguously, in order of increasing total angular momentum.
+*/
+auto n_cartesians_up_to(std::int64_t angmom) noexcept -> std::size_t
+{
+    const auto l = static_cast<std::size_t>(angmom + 1);
+    return l * (l + 1) * (l + 2) / 6;
+}
+
+auto cartesian_index(const elec::AngularMomentumNumbers& angmom) noexcept -> std::size_t
+{
+    const auto total = angmom.x + angmom.y + angmom.z;
+    const auto yz = static_cast<std::size_t>(angmom.y + angmom.z);
+    const auto offset = (total == 0) ? std::size_t {0} : n_cartesians_up_to(total - 1);
+
+    return offset + yz * (yz + 1) / 2 + static_cast<std::size_t>(angmom.z);
+}
+
+auto all_cartesians_up_to(std::int64_t angmom) -> std::vector<elec::AngularMomentumNumbers>
+{
+    auto output = std::vector<elec::AngularMomentumNumbers> {};
+    output.reserve(n_cartesians_up_to(angmom));
+
+    for (std::int64_t total {0}; total <= angmom; ++total) {
+        for (std::int64_t x {total}; x >= 0; --x) {
+            for (std::int64_t z {0}; z <= total - x; ++z) {
+                output.push_back({x, total - x - z, z});
+            }
+        }
+    }
+
+    return output;
+}
+
+auto component(const elec::AngularMomentumNumbers& angmom, std::size_t direction) noexcept -> std::int64_t
+{
+    return (direction == 0) ? angmom.x : (direction == 1) ? angmom.y : angmom.z;
+}
+
+auto component(const coord::Cartesian3D& point, std::size_t direction) noexcept -> double
+{
+    return (direction == 0) ? point.x : (direction == 1) ? point.y : point.z;
+}
+
+/*
+    Returns the direction of the first non-zero component; the recurrence relations can step down
+    along any direction with a non-zero component, and they all give the same result.
+*/
+auto first_nonzero_direction(const elec::AngularMomentumNumbers& angmom) noexcept -> std::size_t
+{
+    if (angmom.x > 0) {
+        return 0;
+    }
+    else if (angmom.y > 0) {
+        return 1;
+    }
+    else {
+        return 2;
+    }
+}
+
+auto step(const elec::AngularMomentumNumbers& angmom, std::size_t direction, std::int64_t amount) noexcept
+    -> elec::AngularMomentumNumbers
+{
+    auto output = angmom;
+    if (direction == 0) {
+        output.x += amount;
+    }
+    else if (direction == 1) {
+        output.y += amount;
+    }
+    else {
+        output.z += amount;
+    }
+
+    return output;
+}
+
+/*
+    Holds the integrals [e0|f0]^(m) for every Cartesian component `e` up to `angmom_e`, every
+    Cartesian component `f` up to `angmom_f`, and every auxiliary index `m` up to their sum.
+*/
+class VerticalRecurrenceTable
+{
+public:
+    VerticalRecurrenceTable(std::int64_t angmom_e, std::int64_t angmom_f)
+        : cartesians_e_ {all_cartesians_up_to(angmom_e)}
+        , cartesians_f_ {all_cartesians_up_to(angmom_f)}
+        , n_auxiliary_ {static_cast<std::size_t>(angmom_e + angmom_f + 1)}
+        , values_(cartesians_e_.size() * cartesians_f_.size() * n_auxiliary_, 0.0)
+    {}
+
+    auto operator()(std::size_t i_e, std::size_t i_f, std::size_t m) noexcept -> double&
+    {
+        return values_[(i_e * cartesians_f_.size() + i_f) * n_auxiliary_ + m];
+    }
+
+    auto cartesians_e() const noexcept -> const std::vector<elec::AngularMomentumNumbers>&
+    {
+        return cartesians_e_;
+    }
+
+    auto cartesians_f() const noexcept -> const std::vector<elec::AngularMomentumNumbers>&
+    {
+        return cartesians_f_;
+    }
+
+    auto n_auxiliary() const noexcept -> std::size_t
+    {
+        return n_auxiliary_;
+    }
+
+private:
+    std::vector<elec::AngularMomentumNumbers> cartesians_e_;
+    std::vector<elec::AngularMomentumNumbers> cartesians_f_;
+    std::size_t n_auxiliary_;
+    std::vector<double> values_;
+};
+
+/*
+    Fills the table with the integrals [e0|f0]^(m) of a single primitive quartet, without the
+    contraction coefficients and normalization constants, using the Obara-Saika VRR:
+
+    [e+1i 0|f0]^(m) = PA_i [e0|f0]^(m) + WP_i [e0|f0]^(m+1)
+                    + e_i / (2p) ([e-1i 0|f0]^(m) - (rho / p) [e-1i 0|f0]^(m+1))
+                    + f_i / (2(p + q)) [e0|f-1i 0]^(m+1)
+
+    [e0|f+1i 0]^(m) = QC_i [e0|f0]^(m) + WQ_i [e0|f0]^(m+1)
+                    + f_i / (2q) ([e0|f-1i 0]^(m) - (rho / q) [e0|f-1i 0]^(m+1))
+                    + e_i / (2(p + q)) [e-1i 0|f0]^(m+1)
+*/
+void fill_vertical_recurrence_table(
+    VerticalRecurrenceTable& table,
+    const elec::ShellPair& bra,
+    const elec::PrimitivePairData& prim_01,
+    const elec::ShellPair& ket,
+    const elec::PrimitivePairData& prim_23
+)
+{
+    const auto p = prim_01.exponent_sum;
+    const auto q = prim_23.exponent_sum;
+    const auto rho = p * q / (p + q);
+
+    const auto& pos_p = prim_01.product_centre;
+    const auto& pos_q = prim_23.product_centre;
+    const auto pos_w = (pos_p * p + pos_q * q) / (p + q);
+
+    const auto pa = pos_p - bra.position0;
+    const auto qc = pos_q - ket.position0;
+    const auto wp = pos_w - pos_p;
+    const auto wq = pos_w - pos_q;
+
+    const auto n_auxiliary = table.n_auxiliary();
+    const auto& cartesians_e = table.cartesians_e();
+    const auto& cartesians_f = table.cartesians_f();
+
+    // [00|00]^(m)
+    const auto boys_arg = rho * coord::norm_squared(pos_p - pos_q);
+    const auto expon_tot = 2.0 * M_PI * M_PI / (p * q) * std::sqrt(M_PI / (p + q));
+    const auto base_coefficient = prim_01.prefactor * prim_23.prefactor * expon_tot;
+    auto boys_values = std::array<double, elec::BOYS_MAX_ORDER + 1> {};
+    elec::boys_all_orders(boys_arg, n_auxiliary - 1, boys_values);
+    for (std::size_t m {0}; m < n_auxiliary; ++m) {
+        table(0, 0, m) = base_coefficient * boys_values[m];
+    }
+
+    const auto one_over_2p = 0.5 / p;
+    const auto one_over_2q = 0.5 / q;
+    const auto one_over_2pq = 0.5 / (p + q);
+    const auto rho_over_p = rho / p;
+    const auto rho_over_q = rho / q;
+
+    for (std::size_t i_f {0}; i_f < cartesians_f.size(); ++i_f) {
+        const auto& angmom_f = cartesians_f[i_f];
+        const auto total_f = static_cast<std::size_t>(elec::total_angular_momentum(angmom_f));
+
+        for (std::size_t i_e {0}; i_e < cartesians_e.size(); ++i_e) {
+            if (i_e == 0 && i_f == 0) {
+                continue;
+            }
+
+            const auto& angmom_e = cartesians_e[i_e];
+            const auto total_e = static_cast<std::size_t>(elec::total_angular_momentum(angmom_e));
+            const auto n_m = n_auxiliary - total_e - total_f;
+
+            if (i_f == 0) {
+                // step down on the bra; the ket term vanishes since f = 0
+                const auto dir = first_nonzero_direction(angmom_e);
+                const auto angmom_e1 = step(angmom_e, dir, -1);
+                const auto i_e1 = cartesian_index(angmom_e1);
+                const auto e1_i = static_cast<double>(component(angmom_e1, dir));
+                const auto i_e2 = (e1_i > 0.0) ? cartesian_index(step(angmom_e1, dir, -1)) : std::size_t {0};
+
+                const auto pa_i = component(pa, dir);
+                const auto wp_i = component(wp, dir);
+
+                for (std::size_t m {0}; m < n_m; ++m) {
+                    auto value = pa_i * table(i_e1, 0, m) + wp_i * table(i_e1, 0, m + 1);
+                    if (e1_i > 0.0) {
+                        value += e1_i * one_over_2p * (table(i_e2, 0, m) - rho_over_p * table(i_e2, 0, m + 1));
+                    }
+
+                    table(i_e, 0, m) = value;
+                }
+            }
+            else {
+                // step down on the ket
+                const auto dir = first_nonzero_direction(angmom_f);
+                const auto angmom_f1 = step(angmom_f, dir, -1);
+                const auto i_f1 = cartesian_index(angmom_f1);
+                const auto f1_i = static_cast<double>(component(angmom_f1, dir));
+                const auto i_f2 = (f1_i > 0.0) ? cartesian_index(step(angmom_f1, dir, -1)) : std::size_t {0};
+
+                const auto e_i = static_cast<double>(component(angmom_e, dir));
+                const auto i_e1 = (e_i > 0.0) ? cartesian_index(step(angmom_e, dir, -1)) : std::size_t {0};
+
+                const auto qc_i = component(qc, dir);
+                const auto wq_i = component(wq, dir);
+
+                for (std::size_t m {0}; m < n_m; ++m) {
+                    auto value = qc_i * table(i_e, i_f1, m) + wq_i * table(i_e, i_f1, m + 1);
+                    if (f1_i > 0.0) {
+                        value += f1_i * one_over_2q * (table(i_e, i_f2, m) - rho_over_q * table(i_e, i_f2, m + 1));
+                    }
+                    if (e_i > 0.0) {
+                        value += e_i * one_over_2pq * table(i_e1, i_f1, m + 1);
+                    }
+
+                    table(i_e, i_f, m) = value;
+                }
+            }
+        }
+    }
+}
+
+/*
+    The contracted integrals (e0|f0), and the displacements between the centres of each pair,
+    that the HRR needs to build up (ab|cd).
+*/
+struct HorizontalRecurrenceInput
+{
+    const std::vector<double>& contracted;
+    std::size_t n_cartesians_f;
+    coord::Cartesian3D ab;
+    coord::Cartesian3D cd;
+};
+
+/*
+    (a b+1i|f0) = (a+1i b|f0) + AB_i (a b|f0)
+*/
+auto horizontal_recurrence_bra(
+    const HorizontalRecurrenceInput& input,
+    const elec::AngularMomentumNumbers& angmom_a,
+    const elec::AngularMomentumNumbers& angmom_b,
+    std::size_t i_f
+) -> double
+{
+    if (elec::total_angular_momentum(angmom_b) == 0) {
+        return input.contracted[cartesian_index(angmom_a) * input.n_cartesians_f + i_f];
+    }
+
+    const auto dir = first_nonzero_direction(angmom_b);
+    const auto angmom_b1 = step(angmom_b, dir, -1);
+
+    const auto term0 = horizontal_recurrence_bra(input, step(angmom_a, dir, +1), angmom_b1, i_f);
+    const auto term1 = horizontal_recurrence_bra(input, angmom_a, angmom_b1, i_f);
+
+    return term0 + component(input.ab, dir) * term1;
+}
+
+/*
+    (ab|c d+1i) = (ab|c+1i d) + CD_i (ab|cd)
+*/
+auto horizontal_recurrence_ket(
+    const HorizontalRecurrenceInput& input,
+    const elec::AngularMomentumNumbers& angmom_a,
+    const elec::AngularMomentumNumbers& angmom_b,
+    const elec::AngularMomentumNumbers& angmom_c,
+    const elec::AngularMomentumNumbers& angmom_d
+) -> double
+{
+    if (elec::total_angular_momentum(angmom_d) == 0) {
+        return horizontal_recurrence_bra(input, angmom_a, angmom_b, cartesian_index(angmom_c));
+    }
+
+    const auto dir = first_nonzero_direction(angmom_d);
+    const auto angmom_d1 = step(angmom_d, dir, -1);
+
+    const auto term0 = horizontal_recurrence_ket(input, angmom_a, angmom_b, step(angmom_c, dir, +1), angmom_d1);
+    const auto term1 = horizontal_recurrence_ket(input, angmom_a, angmom_b, angmom_c, angmom_d1);
+
+    return term0 + component(input.cd, dir) * term1;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto electron_electron_integral_head_gordon_pople(const ShellPair& bra, const ShellPair& ket) -> double
+{
+    const auto angmom_e = total_angular_momentum(bra.angmom0) + total_angular_momentum(bra.angmom1);
+    const auto angmom_f = total_angular_momentum(ket.angmom0) + total_angular_momentum(ket.angmom1);
+
+    auto table = VerticalRecurrenceTable {angmom_e, angmom_f};
+    const auto n_cartesians_e = table.cartesians_e().size();
+    const auto n_cartesians_f = table.cartesians_f().size();
+
+    // only the m = 0 integrals survive the contraction
+    auto contracted = std::vector<double>(n_cartesians_e * n_cartesians_f, 0.0);
+
+    for (const auto& prim_01 : bra.primitives) {
+        for (const auto& prim_23 : ket.primitives) {
+            fill_vertical_recurrence_table(table, bra, prim_01, ket, prim_23);
+
+            const auto coeff = prim_01.coefficient * prim_23.coefficient;
+            for (std::size_t i_e {0}; i_e < n_cartesians_e; ++i_e) {
+                for (std::size_t i_f {0}; i_f < n_cartesians_f; ++i_f) {
+                    contracted[i_e * n_cartesians_f + i_f] += coeff * table(i_e, i_f, 0);
+                }
+            }
+        }
+    }
+
+    const auto input = HorizontalRecurrenceInput {
+        contracted, n_cartesians_f, bra.position0 - bra.position1, ket.position0 - ket.position1
+    };
+
+    return horizontal_recurrence_ket(input, bra.angmom0, bra.angmom1, ket.angmom0, ket.angmom1);
+}
+
+}  // namespace elec
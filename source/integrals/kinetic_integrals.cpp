@@ -4,7 +4,7 @@
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/cartesian3d.hpp"
 #include "elecstruct/integrals/overlap_integrals.hpp"
-#include "elecstruct/mathtools/gaussian.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/orbitals.hpp"
 
 #include "elecstruct/integrals/kinetic_integrals.hpp"
@@ -12,147 +12,62 @@
 namespace
 {
 
-auto term_minusa_minusb(
-    const elec::DirectedAngularMomentumNumbers& angmom_a,
-    const elec::DirectedAngularMomentumNumbers& angmom_b,
-    const elec::DirectedCartesian3D& position_a,
-    const elec::DirectedCartesian3D& position_b,
-    const elec::DirectedCartesian3D& position_centre,
+/*
+    The part of the kinetic integral that comes from the second derivative along a single axis, in
+    terms of the 1D overlap integrals along that axis, for the angular momenta a and b along that axis.
+*/
+auto kinetic_bracket_1d(
+    const elec::OverlapIntegrals1D& overlaps,
+    std::int64_t angmom_a,
+    std::int64_t angmom_b,
     double exponent_a,
     double exponent_b
 ) -> double
 {
-    const auto coeff = 0.5 * static_cast<double>(angmom_a.main * angmom_b.main);
-    const auto unorm_overlap = elec::unnormalized_overlap_integral_1d(
-        {angmom_a.main - 1, exponent_a, position_a.main},
-        {angmom_b.main - 1, exponent_b, position_b.main},
-        position_centre.main
-    );
+    const auto term_ma_mb = 0.5 * static_cast<double>(angmom_a * angmom_b) * overlaps.lower_lower;
+    const auto term_pa_mb = -1.0 * exponent_a * static_cast<double>(angmom_b) * overlaps.raised_lower;
+    const auto term_ma_pb = -1.0 * static_cast<double>(angmom_a) * exponent_b * overlaps.lower_raised;
+    const auto term_pa_pb = 2.0 * exponent_a * exponent_b * overlaps.raised_raised;
 
-    return coeff * unorm_overlap;
+    return term_ma_mb + term_pa_mb + term_ma_pb + term_pa_pb;
 }
 
-auto term_plusa_minusb(
-    const elec::DirectedAngularMomentumNumbers& angmom_a,
-    const elec::DirectedAngularMomentumNumbers& angmom_b,
-    const elec::DirectedCartesian3D& position_a,
-    const elec::DirectedCartesian3D& position_b,
-    const elec::DirectedCartesian3D& position_centre,
-    double exponent_a,
-    double exponent_b
-) -> double
-{
-    const auto coeff = -1.0 * exponent_a * static_cast<double>(angmom_b.main);
-    const auto unorm_overlap = elec::unnormalized_overlap_integral_1d(
-        {angmom_a.main + 1, exponent_a, position_a.main},
-        {angmom_b.main - 1, exponent_b, position_b.main},
-        position_centre.main
-    );
-
-    return coeff * unorm_overlap;
-}
+}  // anonymous namespace
 
-auto term_minusa_plusb(
-    const elec::DirectedAngularMomentumNumbers& angmom_a,
-    const elec::DirectedAngularMomentumNumbers& angmom_b,
-    const elec::DirectedCartesian3D& position_a,
-    const elec::DirectedCartesian3D& position_b,
-    const elec::DirectedCartesian3D& position_centre,
-    double exponent_a,
-    double exponent_b
-) -> double
+namespace elec
 {
-    const auto coeff = -1.0 * static_cast<double>(angmom_a.main) * exponent_b;
-    const auto unorm_overlap = elec::unnormalized_overlap_integral_1d(
-        {angmom_a.main - 1, exponent_a, position_a.main},
-        {angmom_b.main + 1, exponent_b, position_b.main},
-        position_centre.main
-    );
-
-    return coeff * unorm_overlap;
-}
 
-auto term_plusa_plusb(
-    const elec::DirectedAngularMomentumNumbers& angmom_a,
-    const elec::DirectedAngularMomentumNumbers& angmom_b,
-    const elec::DirectedCartesian3D& position_a,
-    const elec::DirectedCartesian3D& position_b,
-    const elec::DirectedCartesian3D& position_centre,
+auto unnormalized_kinetic_integral_1d(
+    const DirectedAngularMomentumNumbers& angmom_a,
+    const DirectedAngularMomentumNumbers& angmom_b,
+    const DirectedCartesian3D& position_a,
+    const DirectedCartesian3D& position_b,
+    const DirectedCartesian3D& position_centre,
     double exponent_a,
-    double exponent_b
+    double exponent_b,
+    double centre_coefficient
 ) -> double
 {
-    const auto coeff = 2.0 * exponent_a * exponent_b;
-    const auto unorm_overlap = elec::unnormalized_overlap_integral_1d(
-        {angmom_a.main + 1, exponent_a, position_a.main},
-        {angmom_b.main + 1, exponent_b, position_b.main},
-        position_centre.main
+    const auto overlaps_main = overlap_integrals_along_axis(
+        angmom_a.main, angmom_b.main, position_a.main, position_b.main, position_centre.main, exponent_a, exponent_b
     );
 
-    return coeff * unorm_overlap;
-}
-
-auto term_direction_other0(
-    const elec::DirectedAngularMomentumNumbers& angmom_a,
-    const elec::DirectedAngularMomentumNumbers& angmom_b,
-    const elec::DirectedCartesian3D& position_a,
-    const elec::DirectedCartesian3D& position_b,
-    const elec::DirectedCartesian3D& position_centre,
-    double exponent_a,
-    double exponent_b
-) -> double
-{
-    return elec::unnormalized_overlap_integral_1d(
+    const auto overlap_other0 = unnormalized_overlap_integral_1d(
         {angmom_a.other0, exponent_a, position_a.other0},
         {angmom_b.other0, exponent_b, position_b.other0},
         position_centre.other0
     );
-}
 
-auto term_direction_other1(
-    const elec::DirectedAngularMomentumNumbers& angmom_a,
-    const elec::DirectedAngularMomentumNumbers& angmom_b,
-    const elec::DirectedCartesian3D& position_a,
-    const elec::DirectedCartesian3D& position_b,
-    const elec::DirectedCartesian3D& position_centre,
-    double exponent_a,
-    double exponent_b
-) -> double
-{
-    return elec::unnormalized_overlap_integral_1d(
+    const auto overlap_other1 = unnormalized_overlap_integral_1d(
         {angmom_a.other1, exponent_a, position_a.other1},
         {angmom_b.other1, exponent_b, position_b.other1},
         position_centre.other1
     );
-}
-
-}  // anonymous namespace
 
-namespace elec
-{
-
-auto unnormalized_kinetic_integral_1d(
-    const DirectedAngularMomentumNumbers& angmom_a,
-    const DirectedAngularMomentumNumbers& angmom_b,
-    const DirectedCartesian3D& position_a,
-    const DirectedCartesian3D& position_b,
-    const DirectedCartesian3D& position_centre,
-    double exponent_a,
-    double exponent_b,
-    double centre_coefficient
-) -> double
-{
-    // clang-format off
+    const auto bracket_main = kinetic_bracket_1d(overlaps_main, angmom_a.main, angmom_b.main, exponent_a, exponent_b);
     const auto kinetic_coefficient = centre_coefficient * overlap_integral_3d_norm(exponent_a, exponent_b);
-    const auto term_other0 = term_direction_other0(angmom_a, angmom_b, position_a, position_b, position_centre, exponent_a, exponent_b);
-    const auto term_other1 = term_direction_other1(angmom_a, angmom_b, position_a, position_b, position_centre, exponent_a, exponent_b);
-    const auto term_ma_mb = term_minusa_minusb(angmom_a, angmom_b, position_a, position_b, position_centre, exponent_a, exponent_b);
-    const auto term_pa_mb = term_plusa_minusb(angmom_a, angmom_b, position_a, position_b, position_centre, exponent_a, exponent_b);
-    const auto term_ma_pb = term_minusa_plusb(angmom_a, angmom_b, position_a, position_b, position_centre, exponent_a, exponent_b);
-    const auto term_pa_pb = term_plusa_plusb(angmom_a, angmom_b, position_a, position_b, position_centre, exponent_a, exponent_b);
-    // clang-format on
-
-    return kinetic_coefficient * term_other0 * term_other1 * (term_ma_mb + term_pa_mb + term_ma_pb + term_pa_pb);
+
+    return kinetic_coefficient * overlap_other0 * overlap_other1 * bracket_main;
 }
 
 auto kinetic_integral_contraction(
@@ -164,51 +79,49 @@ auto kinetic_integral_contraction(
     double exponent1
 ) -> double
 {
-    const auto [pos_product, coeff_product] = elec::math::gaussian_product(position0, position1, exponent0, exponent1);
-
-    const auto angmom0_integ_x = DirectedAngularMomentumNumbers {angmom0};
-    const auto angmom1_integ_x = DirectedAngularMomentumNumbers {angmom1};
-    const auto original0_integ_x = DirectedCartesian3D {position0};
-    const auto original1_integ_x = DirectedCartesian3D {position1};
-    const auto product_integ_x = DirectedCartesian3D {pos_product};
-
-    const auto kinetic_x = unnormalized_kinetic_integral_1d(
-        angmom0_integ_x,
-        angmom1_integ_x,
-        original0_integ_x,
-        original1_integ_x,
-        product_integ_x,
-        exponent0,
-        exponent1,
-        coeff_product
-    );
+    // the contraction coefficients are left as 1.0, so that only the normalization constants remain
+    const auto primitive =
+        make_primitive_pair_data(angmom0, angmom1, position0, position1, {1.0, exponent0}, {1.0, exponent1});
+    const auto pair = ShellPair {angmom0, angmom1, position0, position1, {primitive}};
 
-    const auto kinetic_y = unnormalized_kinetic_integral_1d(
-        left_cyclic_shift(angmom0_integ_x),
-        left_cyclic_shift(angmom1_integ_x),
-        left_cyclic_shift(original0_integ_x),
-        left_cyclic_shift(original1_integ_x),
-        left_cyclic_shift(product_integ_x),
-        exponent0,
-        exponent1,
-        coeff_product
-    );
+    return kinetic_integral(pair);
+}
 
-    const auto kinetic_z = unnormalized_kinetic_integral_1d(
-        right_cyclic_shift(angmom0_integ_x),
-        right_cyclic_shift(angmom1_integ_x),
-        right_cyclic_shift(original0_integ_x),
-        right_cyclic_shift(original1_integ_x),
-        right_cyclic_shift(product_integ_x),
-        exponent0,
-        exponent1,
-        coeff_product
-    );
+auto kinetic_integral(const ShellPair& pair) -> double
+{
+    auto output = double {0.0};
+    for (const auto& primitive : pair.primitives) {
+        const auto overlaps_1d = overlap_integrals_1d(pair, primitive);
+        output += primitive.coefficient * primitive_kinetic_integral(pair, primitive, overlaps_1d);
+    }
+
+    return output;
+}
+
+auto primitive_kinetic_integral(
+    const ShellPair& pair,
+    const PrimitivePairData& primitive,
+    const OverlapIntegrals3D& overlaps_1d
+) -> double
+{
+    const auto& angmom0 = pair.angmom0;
+    const auto& angmom1 = pair.angmom1;
+    const auto exponent0 = primitive.exponent0;
+    const auto exponent1 = primitive.exponent1;
+
+    const auto& [overlaps_x, overlaps_y, overlaps_z] = overlaps_1d;
+
+    const auto bracket_x = kinetic_bracket_1d(overlaps_x, angmom0.x, angmom1.x, exponent0, exponent1);
+    const auto bracket_y = kinetic_bracket_1d(overlaps_y, angmom0.y, angmom1.y, exponent0, exponent1);
+    const auto bracket_z = kinetic_bracket_1d(overlaps_z, angmom0.z, angmom1.z, exponent0, exponent1);
+
+    const auto kinetic_x = bracket_x * overlaps_y.same * overlaps_z.same;
+    const auto kinetic_y = bracket_y * overlaps_z.same * overlaps_x.same;
+    const auto kinetic_z = bracket_z * overlaps_x.same * overlaps_y.same;
 
-    const auto norm0 = elec::math::gaussian_norm(angmom0, exponent0);
-    const auto norm1 = elec::math::gaussian_norm(angmom1, exponent1);
+    const auto kinetic_coefficient = primitive.prefactor * overlap_integral_3d_norm(exponent0, exponent1);
 
-    return norm0 * norm1 * (kinetic_x + kinetic_y + kinetic_z);
+    return kinetic_coefficient * (kinetic_x + kinetic_y + kinetic_z);
 }
 
 }  // namespace elec
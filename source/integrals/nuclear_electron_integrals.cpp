@@ -1,13 +1,19 @@
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
 
+#include "elecstruct/atoms.hpp"
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/cartesian3d.hpp"
 #include "elecstruct/geometry.hpp"
 #include "elecstruct/integrals/boys.hpp"
 #include "elecstruct/integrals/f_coefficient.hpp"
 #include "elecstruct/integrals/nuclear_electron_index_iterator.hpp"
-#include "elecstruct/mathtools/gaussian.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/mathtools/misc.hpp"
 #include "elecstruct/orbitals.hpp"
 
@@ -26,13 +32,69 @@ struct Positions1D
 {
     double position_0;
     double position_1;
-    double position_nuclear;
     double position_product;
 };
 
 /*
-    This function calculates the "A-factor" that repeatedly appears in the calculation of
-    the nuclear-electron attraction integrals.
+    A single term of the sum that gives the "A-factor" along one axis (see below), split into the part
+    that is the same for every nucleus, and the power of the distance between the product centre and
+    the nucleus that it gets multiplied by.
+*/
+struct NuclearATerm
+{
+    double coefficient;
+    std::int64_t nuclear_power;  // l - 2 (r + i)
+    std::int64_t boys_order;     // l - 2 r - i
+};
+
+/*
+    The number of (l, r, i) index triples for an axis with angular momenta that add up to `idx_l_max`.
+*/
+constexpr auto n_nuclear_a_terms(std::int64_t idx_l_max) noexcept -> std::size_t
+{
+    auto count = std::size_t {0};
+    for (std::int64_t idx_l {0}; idx_l <= idx_l_max; ++idx_l) {
+        for (std::int64_t idx_r {0}; 2 * idx_r <= idx_l; ++idx_r) {
+            count += static_cast<std::size_t>((idx_l - 2 * idx_r) / 2 + 1);
+        }
+    }
+
+    return count;
+}
+
+constexpr auto MAX_NUCLEAR_A_TERMS_ = n_nuclear_a_terms(static_cast<std::int64_t>(elec::BOYS_MAX_ORDER));
+
+/*
+    All the terms of the A-factor along one axis; the terms are kept on the stack, because there is
+    one set of them for every primitive pair.
+*/
+class NuclearATerms1D
+{
+public:
+    void push_back(const NuclearATerm& term) noexcept
+    {
+        terms_[size_] = term;
+        ++size_;
+    }
+
+    auto begin() const noexcept -> const NuclearATerm*
+    {
+        return terms_.data();
+    }
+
+    auto end() const noexcept -> const NuclearATerm*
+    {
+        return terms_.data() + size_;  // NOLINT
+    }
+
+private:
+    std::array<NuclearATerm, MAX_NUCLEAR_A_TERMS_> terms_;
+    std::size_t size_ {0};
+};
+
+/*
+    This function calculates the parts of the "A-factor" that repeatedly appears in the calculation of
+    the nuclear-electron attraction integrals that do not depend on the position of the nucleus.
 
     title: Handbook of Computational Quantum Chemistry
     author: David B. Cook
@@ -43,34 +105,47 @@ struct Positions1D
 
     TODO: there might be some numerical instability risks here with the products of factorials?
 */
-auto nuclear_a_factor(
-    std::int64_t idx_l,
-    std::int64_t idx_r,
-    std::int64_t idx_i,
-    const AngularMomenta1D& angmoms,
-    const Positions1D& positions,
-    double epsilon
-) -> double
+auto nuclear_a_terms(const AngularMomenta1D& angmoms, const Positions1D& positions, double epsilon) -> NuclearATerms1D
 {
     const auto diff_0 = positions.position_product - positions.position_0;
     const auto diff_1 = positions.position_product - positions.position_1;
-    const auto diff_n = positions.position_product - positions.position_nuclear;
-    const auto idx_n = idx_l - 2 * (idx_r + idx_i);
 
-    const auto sign = elec::math::neg_1_power(idx_l + idx_i);
-    const auto expansion = elec::f_coefficient(idx_l, angmoms.angmom_0, angmoms.angmom_1, diff_0, diff_1);
-    const auto epsilon_exponent = std::pow(epsilon, idx_r + idx_i);
-    const auto diff_n_exponent = std::pow(diff_n, idx_n);
-    const auto fact_l = elec::math::factorial(idx_l);
+    // default-initialized, rather than value-initialized, so that the unused terms are not zeroed
+    NuclearATerms1D terms;
+
+    for (const auto [idx_l, idx_r, idx_i] : elec::NuclearElectronIndexGenerator(angmoms.angmom_0, angmoms.angmom_1)) {
+        const auto idx_n = idx_l - 2 * (idx_r + idx_i);
+
+        const auto sign = elec::math::neg_1_power(idx_l + idx_i);
+        const auto expansion = elec::f_coefficient(idx_l, angmoms.angmom_0, angmoms.angmom_1, diff_0, diff_1);
+        const auto epsilon_exponent = std::pow(epsilon, idx_r + idx_i);
+        const auto fact_l = elec::math::factorial(idx_l);
 
-    const auto fact_r = elec::math::factorial(idx_r);
-    const auto fact_i = elec::math::factorial(idx_i);
-    const auto fact_diff_n = elec::math::factorial(idx_n);
+        const auto fact_r = elec::math::factorial(idx_r);
+        const auto fact_i = elec::math::factorial(idx_i);
+        const auto fact_diff_n = elec::math::factorial(idx_n);
 
-    const auto numerator = static_cast<double>(sign * fact_l) * expansion * epsilon_exponent * diff_n_exponent;
-    const auto denominator = static_cast<double>(fact_r * fact_i * fact_diff_n);
+        const auto numerator = static_cast<double>(sign * fact_l) * expansion * epsilon_exponent;
+        const auto denominator = static_cast<double>(fact_r * fact_i * fact_diff_n);
 
-    return numerator / denominator;
+        terms.push_back({numerator / denominator, idx_n, idx_l - 2 * idx_r - idx_i});
+    }
+
+    return terms;
+}
+
+/*
+    The powers 0, 1, ..., BOYS_MAX_ORDER of a distance along one axis.
+*/
+auto distance_powers(double distance) noexcept -> std::array<double, elec::BOYS_MAX_ORDER + 1>
+{
+    auto powers = std::array<double, elec::BOYS_MAX_ORDER + 1> {};
+    powers[0] = 1.0;
+    for (std::size_t i {1}; i < powers.size(); ++i) {
+        powers[i] = powers[i - 1] * distance;
+    }
+
+    return powers;
 }
 
 }  // anonymous namespace
@@ -78,6 +153,18 @@ auto nuclear_a_factor(
 namespace elec
 {
 
+auto point_charges(const std::vector<AtomInfo>& atoms) -> std::vector<PointCharge>
+{
+    auto charges = std::vector<PointCharge> {};
+    charges.reserve(atoms.size());
+
+    for (const auto& atom : atoms) {
+        charges.push_back({atom.position, nuclear_charge(atom.label)});
+    }
+
+    return charges;
+}
+
 auto nuclear_electron_integral_contraction(
     const AngularMomentumNumbers& angmom_0,
     const AngularMomentumNumbers& angmom_1,
@@ -89,46 +176,102 @@ auto nuclear_electron_integral_contraction(
     double nuclear_charge
 ) -> double
 {
-    const auto [pos_product, coeff_product] =
-        elec::math::gaussian_product(pos_gauss0, pos_gauss1, exponent0, exponent1);
+    // the contraction coefficients are left as 1.0, so that only the normalization constants remain
+    const auto primitive =
+        make_primitive_pair_data(angmom_0, angmom_1, pos_gauss0, pos_gauss1, {1.0, exponent0}, {1.0, exponent1});
+    const auto pair = ShellPair {angmom_0, angmom_1, pos_gauss0, pos_gauss1, {primitive}};
+
+    return nuclear_electron_integral(pair, pos_nuclear, nuclear_charge);
+}
+
+auto nuclear_electron_integral(const ShellPair& pair, const coord::Cartesian3D& pos_nuclear, double nuclear_charge)
+    -> double
+{
+    const auto nucleus = PointCharge {pos_nuclear, nuclear_charge};
 
-    const auto norm0 = elec::math::gaussian_norm(angmom_0, exponent0);
-    const auto norm1 = elec::math::gaussian_norm(angmom_1, exponent1);
+    return nuclear_electron_integral(pair, std::span<const PointCharge> {&nucleus, 1});
+}
 
-    const auto g_value = exponent0 + exponent1;
+auto nuclear_electron_integral(const ShellPair& pair, std::span<const PointCharge> nuclei) -> double
+{
+    auto output = double {0.0};
+    for (const auto& primitive : pair.primitives) {
+        output += primitive.coefficient * primitive_nuclear_electron_integral(pair, primitive, nuclei);
+    }
+
+    return output;
+}
+
+auto primitive_nuclear_electron_integral(
+    const ShellPair& pair,
+    const PrimitivePairData& primitive,
+    std::span<const PointCharge> nuclei
+) -> double
+{
+    const auto& angmom_0 = pair.angmom0;
+    const auto& angmom_1 = pair.angmom1;
+    const auto& pos_gauss0 = pair.position0;
+    const auto& pos_gauss1 = pair.position1;
+    const auto& pos_product = primitive.product_centre;
+
+    const auto g_value = primitive.exponent_sum;
     const auto epsilon = 0.25 / g_value;
-    const auto boys_arg = g_value * coord::norm_squared(pos_product - pos_nuclear);
 
+    // every Boys function index in the loops below is bounded by the total angular momentum of the pair
+    const auto boys_order_max = total_angular_momentum(angmom_0) + total_angular_momentum(angmom_1);
+    if (static_cast<std::size_t>(boys_order_max) > BOYS_MAX_ORDER) {
+        throw std::runtime_error {"Encountered an angular momentum beyond the supported orders of the Boys function."};
+    }
+
+    // only the powers of the distances to the nucleus, and the Boys function, depend on the nucleus
     const auto angmoms_x = AngularMomenta1D {angmom_0.x, angmom_1.x};
     const auto angmoms_y = AngularMomenta1D {angmom_0.y, angmom_1.y};
     const auto angmoms_z = AngularMomenta1D {angmom_0.z, angmom_1.z};
-    const auto positions_x = Positions1D {pos_gauss0.x, pos_gauss1.x, pos_nuclear.x, pos_product.x};
-    const auto positions_y = Positions1D {pos_gauss0.y, pos_gauss1.y, pos_nuclear.y, pos_product.y};
-    const auto positions_z = Positions1D {pos_gauss0.z, pos_gauss1.z, pos_nuclear.z, pos_product.z};
+    const auto positions_x = Positions1D {pos_gauss0.x, pos_gauss1.x, pos_product.x};
+    const auto positions_y = Positions1D {pos_gauss0.y, pos_gauss1.y, pos_product.y};
+    const auto positions_z = Positions1D {pos_gauss0.z, pos_gauss1.z, pos_product.z};
+
+    const auto terms_x = nuclear_a_terms(angmoms_x, positions_x, epsilon);
+    const auto terms_y = nuclear_a_terms(angmoms_y, positions_y, epsilon);
+    const auto terms_z = nuclear_a_terms(angmoms_z, positions_z, epsilon);
+
+    auto boys_values = std::array<double, BOYS_MAX_ORDER + 1> {};
+    auto charge_weighted_integral = double {0.0};
 
-    auto integral = double {0.0};
+    for (const auto& nucleus : nuclei) {
+        const auto diff_n = pos_product - nucleus.position;
+        const auto boys_arg = g_value * coord::norm_squared(diff_n);
+        boys_all_orders(boys_arg, static_cast<std::size_t>(boys_order_max), boys_values);
 
-    // clang-format off
-    for (const auto [idx_l, idx_r, idx_i] : NuclearElectronIndexGenerator(angmom_0.x, angmom_1.x)) {
-        const auto a_factor_x = nuclear_a_factor(idx_l, idx_r, idx_i, angmoms_x, positions_x, epsilon);
+        const auto powers_x = distance_powers(diff_n.x);
+        const auto powers_y = distance_powers(diff_n.y);
+        const auto powers_z = distance_powers(diff_n.z);
 
-        for (const auto [idx_m, idx_s, idx_j] : NuclearElectronIndexGenerator(angmom_0.y, angmom_1.y)) {
-            const auto a_factor_y = nuclear_a_factor(idx_m, idx_s, idx_j, angmoms_y, positions_y, epsilon);
+        auto integral = double {0.0};
 
-            for (const auto [idx_n, idx_t, idx_k] : NuclearElectronIndexGenerator(angmom_0.z, angmom_1.z)) {
-                const auto a_factor_z = nuclear_a_factor(idx_n, idx_t, idx_k, angmoms_z, positions_z, epsilon);
+        // clang-format off
+        for (const auto& term_x : terms_x) {
+            const auto a_factor_x = term_x.coefficient * powers_x[static_cast<std::size_t>(term_x.nuclear_power)];
 
-                const auto idx_boys = idx_l + idx_m + idx_n - 2 * (idx_r + idx_s + idx_t) - (idx_i + idx_j + idx_k);
-                const auto boys_factor = boys_beylkin_sharma(boys_arg, static_cast<std::size_t>(idx_boys));
+            for (const auto& term_y : terms_y) {
+                const auto a_factor_y = term_y.coefficient * powers_y[static_cast<std::size_t>(term_y.nuclear_power)];
 
-                const auto contribution = a_factor_x * a_factor_y * a_factor_z * boys_factor;
-                integral += contribution;
+                for (const auto& term_z : terms_z) {
+                    const auto a_factor_z = term_z.coefficient * powers_z[static_cast<std::size_t>(term_z.nuclear_power)];
+
+                    const auto idx_boys = term_x.boys_order + term_y.boys_order + term_z.boys_order;
+                    const auto boys_factor = boys_values[static_cast<std::size_t>(idx_boys)];
+
+                    integral += a_factor_x * a_factor_y * a_factor_z * boys_factor;
+                }
             }
         }
+        // clang-format on
+
+        charge_weighted_integral += nucleus.charge * integral;
     }
-    // clang-format on
 
-    return -(2.0 * M_PI / g_value) * coeff_product * nuclear_charge * norm0 * norm1 * integral;
+    return -(2.0 * M_PI / g_value) * primitive.prefactor * charge_weighted_integral;
 }
 
 }  // namespace elec
@@ -0,0 +1,29 @@
+#include <span>
+
+#include "elecstruct/integrals/kinetic_integrals.hpp"
+#include "elecstruct/integrals/nuclear_electron_integrals.hpp"
+#include "elecstruct/integrals/overlap_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+#include "elecstruct/integrals/one_electron_integrals.hpp"
+
+namespace elec
+{
+
+auto one_electron_integrals(const ShellPair& pair, std::span<const PointCharge> nuclei) -> OneElectronIntegrals
+{
+    auto output = OneElectronIntegrals {0.0, 0.0, 0.0};
+
+    for (const auto& primitive : pair.primitives) {
+        const auto overlaps_1d = overlap_integrals_1d(pair, primitive);
+        const auto coefficient = primitive.coefficient;
+
+        output.overlap += coefficient * primitive_overlap_integral(primitive, overlaps_1d);
+        output.kinetic += coefficient * primitive_kinetic_integral(pair, primitive, overlaps_1d);
+        output.nuclear_electron += coefficient * primitive_nuclear_electron_integral(pair, primitive, nuclei);
+    }
+
+    return output;
+}
+
+}  // namespace elec
@@ -4,7 +4,7 @@
 
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/cartesian3d.hpp"
-#include "elecstruct/mathtools/gaussian.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/mathtools/misc.hpp"
 #include "elecstruct/mathtools/n_choose_k.hpp"
 #include "elecstruct/orbitals.hpp"
@@ -88,34 +88,72 @@ auto overlap_integral_contraction(
     double exponent1
 ) -> double
 {
-    const auto [pos_product, coeff_product] = elec::math::gaussian_product(position0, position1, exponent0, exponent1);
+    // the contraction coefficients are left as 1.0, so that only the normalization constants remain
+    const auto primitive =
+        make_primitive_pair_data(angmom0, angmom1, position0, position1, {1.0, exponent0}, {1.0, exponent1});
+    const auto pair = ShellPair {angmom0, angmom1, position0, position1, {primitive}};
 
-    const auto norm0 = elec::math::gaussian_norm(angmom0, exponent0);
-    const auto norm1 = elec::math::gaussian_norm(angmom1, exponent1);
-    const auto overlap_norm = overlap_integral_3d_norm(exponent0, exponent1);
-    const auto total_norm = norm0 * norm1 * overlap_norm;
+    return overlap_integral(pair);
+}
+
+auto overlap_integral(const ShellPair& pair) -> double
+{
+    auto output = double {0.0};
+    for (const auto& primitive : pair.primitives) {
+        const auto overlaps_1d = overlap_integrals_1d(pair, primitive);
+        output += primitive.coefficient * primitive_overlap_integral(primitive, overlaps_1d);
+    }
+
+    return output;
+}
+
+auto overlap_integrals_along_axis(
+    std::int64_t angmom0,
+    std::int64_t angmom1,
+    double position0,
+    double position1,
+    double product_centre,
+    double exponent0,
+    double exponent1
+) -> OverlapIntegrals1D
+{
+    const auto overlap = [&](std::int64_t shift0, std::int64_t shift1)
+    {
+        return unnormalized_overlap_integral_1d(
+            {angmom0 + shift0, exponent0, position0},
+            {angmom1 + shift1, exponent1, position1},
+            product_centre
+        );
+    };
+
+    return {overlap(0, 0), overlap(-1, -1), overlap(1, -1), overlap(-1, 1), overlap(1, 1)};
+}
+
+auto overlap_integrals_1d(const ShellPair& pair, const PrimitivePairData& primitive) -> OverlapIntegrals3D
+{
+    const auto& angmom0 = pair.angmom0;
+    const auto& angmom1 = pair.angmom1;
+    const auto& position0 = pair.position0;
+    const auto& position1 = pair.position1;
+    const auto& centre = primitive.product_centre;
+    const auto exponent0 = primitive.exponent0;
+    const auto exponent1 = primitive.exponent1;
 
     // clang-format off
-    const auto unorm_overlap_x = unnormalized_overlap_integral_1d(
-        {angmom0.x, exponent0, position0.x},
-        {angmom1.x, exponent1, position1.x},
-        pos_product.x
-    );
-
-    const auto unorm_overlap_y = unnormalized_overlap_integral_1d(
-        {angmom0.y, exponent0, position0.y},
-        {angmom1.y, exponent1, position1.y},
-        pos_product.y
-    );
-
-    const auto unorm_overlap_z = unnormalized_overlap_integral_1d(
-        {angmom0.z, exponent0, position0.z},
-        {angmom1.z, exponent1, position1.z},
-        pos_product.z
-    );
+    return {
+        overlap_integrals_along_axis(angmom0.x, angmom1.x, position0.x, position1.x, centre.x, exponent0, exponent1),
+        overlap_integrals_along_axis(angmom0.y, angmom1.y, position0.y, position1.y, centre.y, exponent0, exponent1),
+        overlap_integrals_along_axis(angmom0.z, angmom1.z, position0.z, position1.z, centre.z, exponent0, exponent1)
+    };
     // clang-format on
+}
+
+auto primitive_overlap_integral(const PrimitivePairData& primitive, const OverlapIntegrals3D& overlaps_1d) -> double
+{
+    const auto overlap_norm = overlap_integral_3d_norm(primitive.exponent0, primitive.exponent1);
+    const auto unorm_overlap = overlaps_1d[0].same * overlaps_1d[1].same * overlaps_1d[2].same;
 
-    return coeff_product * unorm_overlap_x * unorm_overlap_y * unorm_overlap_z * total_norm;
+    return primitive.prefactor * unorm_overlap * overlap_norm;
 }
 
 }  // namespace elec
@@ -0,0 +1,308 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/geometry.hpp"
+#include "elecstruct/integrals/boys.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/mathtools/n_choose_k.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "elecstruct/integrals/rys_quadrature.hpp"
+
+namespace
+{
+
+constexpr auto N_MAX_ = elec::RYS_MAX_N_ROOTS;
+
+// a fixed upper bound on the size keeps the eigensolver off of the heap
+constexpr auto N_MAX_EIGEN_ = static_cast<int>(N_MAX_);
+using JacobiMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, N_MAX_EIGEN_, N_MAX_EIGEN_>;
+using JacobiEigenSolver = Eigen::SelfAdjointEigenSolver<JacobiMatrix>;
+
+/*
+    The recurrence coefficients of the monic orthogonal polynomials, from the moments of the weight
+    function, using the Chebyshev algorithm in
+
+    title: Orthogonal Polynomials: Computation and Approximation
+    author: Walter Gautschi
+    year: 2004
+    published: Oxford University Press
+
+    in section 2.1.7. The algorithm is ill-conditioned for large numbers of roots, but the Rys
+    weight function is only ever needed for a handful of them.
+*/
+struct RecurrenceCoefficients
+{
+    std::array<double, N_MAX_> alpha;
+    std::array<double, N_MAX_> beta;
+};
+
+auto chebyshev_algorithm(const std::array<double, 2 * N_MAX_>& moments, std::size_t n_roots) -> RecurrenceCoefficients
+{
+    // only the two most recent rows of sigma are ever needed
+    auto sigma_prev = std::array<double, 2 * N_MAX_> {};
+    auto sigma_curr = moments;
+
+    auto coeffs = RecurrenceCoefficients {};
+    coeffs.alpha[0] = moments[1] / moments[0];
+    coeffs.beta[0] = moments[0];
+
+    for (std::size_t k {1}; k < n_roots; ++k) {
+        auto sigma_next = std::array<double, 2 * N_MAX_> {};
+        for (std::size_t l {k}; l < 2 * n_roots - k; ++l) {
+            const auto alpha_term = coeffs.alpha[k - 1] * sigma_curr[l];
+            const auto beta_term = coeffs.beta[k - 1] * sigma_prev[l];
+            sigma_next[l] = sigma_curr[l + 1] - alpha_term - beta_term;
+        }
+
+        coeffs.alpha[k] = sigma_next[k + 1] / sigma_next[k] - sigma_curr[k] / sigma_curr[k - 1];
+        coeffs.beta[k] = sigma_next[k] / sigma_curr[k - 1];
+
+        sigma_prev = sigma_curr;
+        sigma_curr = sigma_next;
+    }
+
+    return coeffs;
+}
+
+auto component(const elec::AngularMomentumNumbers& angmom, std::size_t direction) noexcept -> std::int64_t
+{
+    return (direction == 0) ? angmom.x : (direction == 1) ? angmom.y : angmom.z;
+}
+
+auto component(const coord::Cartesian3D& point, std::size_t direction) noexcept -> double
+{
+    return (direction == 0) ? point.x : (direction == 1) ? point.y : point.z;
+}
+
+/*
+    The largest angular momentum of a single orbital is the same as the largest total angular
+    momentum of a quartet, so that a quartet with all of it on one orbital still fits.
+*/
+constexpr auto ANGMOM_MAX_ = std::size_t {2 * N_MAX_ - 2};
+
+using Integrals2D = std::array<std::array<double, ANGMOM_MAX_ + 1>, ANGMOM_MAX_ + 1>;
+
+/*
+    The quantities needed for the recurrence relations of the 2D integrals along a single axis, at a
+    single quadrature point; the bra and ket recurrences are
+
+        G(e+1, f) = C00 G(e, f) + e B10 G(e-1, f) + f B00 G(e, f-1)
+        G(e, f+1) = D00 G(e, f) + f B01 G(e, f-1) + e B00 G(e-1, f)
+*/
+struct RecurrenceFactors
+{
+    double c00;
+    double d00;
+    double b00;
+    double b10;
+    double b01;
+};
+
+void fill_integrals_2d(
+    Integrals2D& table,
+    const RecurrenceFactors& factors,
+    std::size_t angmom_e,
+    std::size_t angmom_f
+)
+{
+    table[0][0] = 1.0;
+
+    for (std::size_t e {0}; e < angmom_e; ++e) {
+        const auto previous = (e > 0) ? table[e - 1][0] : 0.0;
+        table[e + 1][0] = factors.c00 * table[e][0] + static_cast<double>(e) * factors.b10 * previous;
+    }
+
+    for (std::size_t f {0}; f < angmom_f; ++f) {
+        for (std::size_t e {0}; e <= angmom_e; ++e) {
+            auto value = factors.d00 * table[e][f];
+            if (f > 0) {
+                value += static_cast<double>(f) * factors.b01 * table[e][f - 1];
+            }
+            if (e > 0) {
+                value += static_cast<double>(e) * factors.b00 * table[e - 1][f];
+            }
+
+            table[e][f + 1] = value;
+        }
+    }
+}
+
+/*
+    Moves the angular momentum from the first to the second centre of each pair, using
+
+        (x - B)^b = sum_k (b choose k) (x - A)^k (A - B)^(b - k)
+*/
+auto transfer_to_second_centres(
+    const Integrals2D& table,
+    std::int64_t angmom_a,
+    std::int64_t angmom_b,
+    std::int64_t angmom_c,
+    std::int64_t angmom_d,
+    double ab,
+    double cd
+) -> double
+{
+    auto output = double {0.0};
+
+    using elec::math::N_CHOOSE_K_GRID;
+
+    for (std::int64_t k {0}; k <= angmom_b; ++k) {
+        const auto coeff_b = static_cast<double>(N_CHOOSE_K_GRID.at(angmom_b, k)) * std::pow(ab, angmom_b - k);
+        for (std::int64_t l {0}; l <= angmom_d; ++l) {
+            const auto coeff_d = static_cast<double>(N_CHOOSE_K_GRID.at(angmom_d, l)) * std::pow(cd, angmom_d - l);
+            const auto i_e = static_cast<std::size_t>(angmom_a + k);
+            const auto i_f = static_cast<std::size_t>(angmom_c + l);
+
+            output += coeff_b * coeff_d * table[i_e][i_f];
+        }
+    }
+
+    return output;
+}
+
+/*
+    The two-electron integral between the primitive pairs `prim_01` and `prim_23`, without the
+    contraction coefficients and normalization constants.
+*/
+auto electron_electron_integral_rys_primitive(
+    const elec::ShellPair& bra,
+    const elec::PrimitivePairData& prim_01,
+    const elec::ShellPair& ket,
+    const elec::PrimitivePairData& prim_23
+) -> double
+{
+    const auto p = prim_01.exponent_sum;
+    const auto q = prim_23.exponent_sum;
+    const auto rho = p * q / (p + q);
+
+    const auto& pos_p = prim_01.product_centre;
+    const auto& pos_q = prim_23.product_centre;
+
+    const auto pa = pos_p - bra.position0;
+    const auto qc = pos_q - ket.position0;
+    const auto pq = pos_p - pos_q;
+    const auto ab = bra.position0 - bra.position1;
+    const auto cd = ket.position0 - ket.position1;
+
+    const auto angmom_bra = elec::total_angular_momentum(bra.angmom0) + elec::total_angular_momentum(bra.angmom1);
+    const auto angmom_ket = elec::total_angular_momentum(ket.angmom0) + elec::total_angular_momentum(ket.angmom1);
+    const auto angmom_total = angmom_bra + angmom_ket;
+    const auto n_roots = static_cast<std::size_t>(angmom_total / 2 + 1);
+
+    if (n_roots > elec::RYS_MAX_N_ROOTS) {
+        throw std::runtime_error {"The Rys quadrature only supports quartets with a total angular momentum up to 10."};
+    }
+
+    const auto quadrature = elec::rys_quadrature(rho * coord::norm_squared(pq), n_roots);
+
+    auto table = Integrals2D {};
+    auto integral = double {0.0};
+
+    for (std::size_t i_root {0}; i_root < n_roots; ++i_root) {
+        const auto u = quadrature.roots[i_root];
+
+        auto product = quadrature.weights[i_root];
+        for (std::size_t dir {0}; dir < 3; ++dir) {
+            const auto angmom_a = component(bra.angmom0, dir);
+            const auto angmom_b = component(bra.angmom1, dir);
+            const auto angmom_c = component(ket.angmom0, dir);
+            const auto angmom_d = component(ket.angmom1, dir);
+
+            const auto factors = RecurrenceFactors {
+                component(pa, dir) - (q / (p + q)) * u * component(pq, dir),
+                component(qc, dir) + (p / (p + q)) * u * component(pq, dir),
+                0.5 * u / (p + q),
+                0.5 / p * (1.0 - rho / p * u),
+                0.5 / q * (1.0 - rho / q * u)
+            };
+
+            const auto angmom_e = static_cast<std::size_t>(angmom_a + angmom_b);
+            const auto angmom_f = static_cast<std::size_t>(angmom_c + angmom_d);
+            fill_integrals_2d(table, factors, angmom_e, angmom_f);
+
+            product *= transfer_to_second_centres(
+                table, angmom_a, angmom_b, angmom_c, angmom_d, component(ab, dir), component(cd, dir)
+            );
+        }
+
+        integral += product;
+    }
+
+    const auto coeff_tot = prim_01.prefactor * prim_23.prefactor;
+    const auto expon_tot = 2.0 * M_PI * M_PI / (p * q) * std::sqrt(M_PI / (p + q));
+
+    return integral * coeff_tot * expon_tot;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto rys_quadrature(double x, std::size_t n_roots) -> RysQuadrature
+{
+    if (n_roots == 0 || n_roots > RYS_MAX_N_ROOTS) {
+        throw std::runtime_error {"The number of Rys quadrature points must be between 1 and 6."};
+    }
+
+    auto moments = std::array<double, 2 * RYS_MAX_N_ROOTS> {};
+    boys_all_orders(x, 2 * n_roots - 1, moments);
+
+    const auto coeffs = chebyshev_algorithm(moments, n_roots);
+
+    auto output = RysQuadrature {n_roots, {}, {}};
+
+    if (n_roots == 1) {
+        output.roots[0] = coeffs.alpha[0];
+        output.weights[0] = coeffs.beta[0];
+        return output;
+    }
+
+    // the Golub-Welsch algorithm; the roots are the eigenvalues of the Jacobi matrix, and the weights
+    // come from the first component of each normalized eigenvector
+    const auto size = static_cast<Eigen::Index>(n_roots);
+    auto diagonal = JacobiEigenSolver::RealVectorType {size};
+    auto subdiagonal = JacobiEigenSolver::RealVectorType {size - 1};
+    for (Eigen::Index i {0}; i < size; ++i) {
+        diagonal(i) = coeffs.alpha[static_cast<std::size_t>(i)];
+    }
+    for (Eigen::Index i {0}; i < size - 1; ++i) {
+        subdiagonal(i) = std::sqrt(coeffs.beta[static_cast<std::size_t>(i + 1)]);
+    }
+
+    auto solver = JacobiEigenSolver {};
+    solver.computeFromTridiagonal(diagonal, subdiagonal, Eigen::ComputeEigenvectors);
+    if (solver.info() != Eigen::Success) {
+        throw std::runtime_error {"Failed to find the roots of the Rys polynomial."};
+    }
+
+    for (Eigen::Index i {0}; i < size; ++i) {
+        const auto first_component = solver.eigenvectors()(0, i);
+        output.roots[static_cast<std::size_t>(i)] = solver.eigenvalues()(i);
+        output.weights[static_cast<std::size_t>(i)] = coeffs.beta[0] * first_component * first_component;
+    }
+
+    return output;
+}
+
+auto electron_electron_integral_rys(const ShellPair& bra, const ShellPair& ket) -> double
+{
+    auto output = double {0.0};
+    for (const auto& prim_01 : bra.primitives) {
+        for (const auto& prim_23 : ket.primitives) {
+            const auto coeff = prim_01.coefficient * prim_23.coefficient;
+            output += coeff * electron_electron_integral_rys_primitive(bra, prim_01, ket, prim_23);
+        }
+    }
+
+    return output;
+}
+
+}  // namespace elec
@@ -0,0 +1,79 @@
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+#include "elecstruct/integrals/schwarz_screening.hpp"
+
+namespace
+{
+
+/*
+    The bounds are stored for each unordered pair of basis functions, using the same compound
+    index as the first stage of the Yoshimine sort.
+*/
+auto pair_index(std::size_t i0, std::size_t i1) noexcept -> std::size_t
+{
+    if (i0 > i1) {
+        return i0 * (i0 + 1) / 2 + i1;
+    }
+    else {
+        return i1 * (i1 + 1) / 2 + i0;
+    }
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+SchwarzScreening::SchwarzScreening(const std::vector<AtomicOrbitalInfoSTO3G>& basis, double tolerance)
+    : SchwarzScreening {ShellPairData {basis}, tolerance}
+{}
+
+SchwarzScreening::SchwarzScreening(const ShellPairData& shell_pairs, double tolerance)
+    : tolerance_ {tolerance}
+{
+    if (tolerance < 0.0) {
+        throw std::runtime_error {"The Schwarz screening tolerance must be non-negative."};
+    }
+
+    const auto size = shell_pairs.n_basis_functions();
+    pair_bounds_.resize(size * (size + 1) / 2);
+
+    for (std::size_t i0 {0}; i0 < size; ++i0) {
+        for (std::size_t i1 {0}; i1 <= i0; ++i1) {
+            const auto& pair = shell_pairs.get(i0, i1);
+            const auto diagonal = electron_electron_integral(pair, pair);
+            pair_bounds_[pair_index(i0, i1)] = std::sqrt(std::fabs(diagonal));
+        }
+    }
+}
+
+auto SchwarzScreening::pair_bound(std::size_t i0, std::size_t i1) const noexcept -> double
+{
+    return pair_bounds_[pair_index(i0, i1)];
+}
+
+auto SchwarzScreening::bound(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept
+    -> double
+{
+    return pair_bound(i0, i1) * pair_bound(i2, i3);
+}
+
+auto SchwarzScreening::is_negligible(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept
+    -> bool
+{
+    return bound(i0, i1, i2, i3) < tolerance_;
+}
+
+auto SchwarzScreening::tolerance() const noexcept -> double
+{
+    return tolerance_;
+}
+
+}  // namespace elec
@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "elecstruct/basis/auxiliary_basis.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/mathtools/gaussian.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "elecstruct/integrals/shell_pair_data.hpp"
+
+namespace
+{
+
+auto pair_index(std::size_t i0, std::size_t i1) noexcept -> std::size_t
+{
+    if (i0 > i1) {
+        return i0 * (i0 + 1) / 2 + i1;
+    }
+    else {
+        return i1 * (i1 + 1) / 2 + i0;
+    }
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto make_primitive_pair_data(
+    const AngularMomentumNumbers& angmom0,
+    const AngularMomentumNumbers& angmom1,
+    const coord::Cartesian3D& position0,
+    const coord::Cartesian3D& position1,
+    const GaussianContractionInfo& gaussian0,
+    const GaussianContractionInfo& gaussian1
+) -> PrimitivePairData
+{
+    const auto exponent0 = gaussian0.exponent_coeff;
+    const auto exponent1 = gaussian1.exponent_coeff;
+
+    const auto [product_centre, prefactor] = elec::math::gaussian_product(position0, position1, exponent0, exponent1);
+
+    const auto norm0 = elec::math::gaussian_norm(angmom0, exponent0);
+    const auto norm1 = elec::math::gaussian_norm(angmom1, exponent1);
+    const auto coefficient = gaussian0.contraction_coeff * gaussian1.contraction_coeff * norm0 * norm1;
+
+    return PrimitivePairData {exponent0, exponent1, exponent0 + exponent1, product_centre, prefactor, coefficient};
+}
+
+auto make_shell_pair(const AtomicOrbitalInfoSTO3G& orbital0, const AtomicOrbitalInfoSTO3G& orbital1) -> ShellPair
+{
+    auto primitives = std::vector<PrimitivePairData> {};
+    primitives.reserve(orbital0.gaussians.size() * orbital1.gaussians.size());
+
+    for (const auto& gaussian0 : orbital0.gaussians) {
+        for (const auto& gaussian1 : orbital1.gaussians) {
+            primitives.push_back(make_primitive_pair_data(
+                orbital0.angular_momentum,
+                orbital1.angular_momentum,
+                orbital0.position,
+                orbital1.position,
+                gaussian0,
+                gaussian1
+            ));
+        }
+    }
+
+    return ShellPair {
+        orbital0.angular_momentum,
+        orbital1.angular_momentum,
+        orbital0.position,
+        orbital1.position,
+        std::move(primitives)
+    };
+}
+
+auto make_auxiliary_shell_pair(const AuxiliaryFunctionInfo& function) -> ShellPair
+{
+    const auto norm = elec::math::gaussian_norm(function.angular_momentum, function.exponent);
+
+    // the product with a gaussian of zero exponent leaves the centre and the exponent unchanged
+    const auto primitive = PrimitivePairData {function.exponent, 0.0, function.exponent, function.position, 1.0, norm};
+
+    return ShellPair {
+        function.angular_momentum,
+        AngularMomentumNumbers {0, 0, 0},
+        function.position,
+        function.position,
+        {primitive}
+    };
+}
+
+ShellPairData::ShellPairData(const std::vector<AtomicOrbitalInfoSTO3G>& basis)
+    : n_basis_functions_ {basis.size()}
+{
+    const auto size = basis.size();
+    pairs_.reserve(size * (size + 1) / 2);
+
+    for (std::size_t i0 {0}; i0 < size; ++i0) {
+        for (std::size_t i1 {0}; i1 <= i0; ++i1) {
+            pairs_.push_back(make_shell_pair(basis[i0], basis[i1]));
+        }
+    }
+}
+
+auto ShellPairData::get(std::size_t i0, std::size_t i1) const noexcept -> const ShellPair&
+{
+    return pairs_[pair_index(i0, i1)];
+}
+
+auto ShellPairData::n_basis_functions() const noexcept -> std::size_t
+{
+    return n_basis_functions_;
+}
+
+}  // namespace elec
@@ -0,0 +1,262 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/geometry.hpp"
+#include "elecstruct/integrals/boys_tabulated.hpp"
+#include "elecstruct/integrals/head_gordon_pople.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "elecstruct/integrals/specialized_electron_electron_integrals.hpp"
+
+namespace
+{
+
+constexpr auto N_ANGULAR_MOMENTA_ = static_cast<std::size_t>(elec::SPECIALIZED_MAX_ANGULAR_MOMENTUM + 1);
+constexpr auto N_BOYS_ORDERS_ = static_cast<std::size_t>(4 * elec::SPECIALIZED_MAX_ANGULAR_MOMENTUM + 1);
+constexpr auto N_KERNELS_ = N_ANGULAR_MOMENTA_ * N_ANGULAR_MOMENTA_ * N_ANGULAR_MOMENTA_ * N_ANGULAR_MOMENTA_;
+
+/*
+    The direction (0, 1, 2 for x, y, z) in which each of the four orbitals of the quartet points;
+    the value for an s-orbital is never used.
+*/
+using Directions = std::array<std::size_t, 4>;
+
+auto direction(const elec::AngularMomentumNumbers& angmom) noexcept -> std::size_t
+{
+    if (angmom.x > 0) {
+        return 0;
+    }
+    else if (angmom.y > 0) {
+        return 1;
+    }
+    else {
+        return 2;
+    }
+}
+
+auto to_array(const coord::Cartesian3D& point) noexcept -> std::array<double, 3>
+{
+    return {point.x, point.y, point.z};
+}
+
+/*
+    Everything the recurrence relation needs for a single primitive quartet; the displacements are
+    stored as arrays, so that they can be indexed by the direction of a p-orbital.
+*/
+struct PrimitiveQuartetTerms
+{
+    std::array<double, 3> pa;
+    std::array<double, 3> pb;
+    std::array<double, 3> qc;
+    std::array<double, 3> qd;
+    std::array<double, 3> wp;
+    std::array<double, 3> wq;
+    double one_over_2p;
+    double one_over_2q;
+    double one_over_2pq;
+    double rho_over_p;
+    double rho_over_q;
+
+    // the integrals [00|00]^(m), with the prefactors of both primitive pairs included
+    std::array<double, N_BOYS_ORDERS_> ssss;
+};
+
+auto make_primitive_quartet_terms(
+    const elec::ShellPair& bra,
+    const elec::PrimitivePairData& prim_01,
+    const elec::ShellPair& ket,
+    const elec::PrimitivePairData& prim_23,
+    std::size_t boys_order_max
+) -> PrimitiveQuartetTerms
+{
+    const auto p = prim_01.exponent_sum;
+    const auto q = prim_23.exponent_sum;
+    const auto rho = p * q / (p + q);
+
+    const auto& pos_p = prim_01.product_centre;
+    const auto& pos_q = prim_23.product_centre;
+    const auto pos_w = (pos_p * p + pos_q * q) / (p + q);
+
+    auto terms = PrimitiveQuartetTerms {};
+    terms.pa = to_array(pos_p - bra.position0);
+    terms.pb = to_array(pos_p - bra.position1);
+    terms.qc = to_array(pos_q - ket.position0);
+    terms.qd = to_array(pos_q - ket.position1);
+    terms.wp = to_array(pos_w - pos_p);
+    terms.wq = to_array(pos_w - pos_q);
+    terms.one_over_2p = 0.5 / p;
+    terms.one_over_2q = 0.5 / q;
+    terms.one_over_2pq = 0.5 / (p + q);
+    terms.rho_over_p = rho / p;
+    terms.rho_over_q = rho / q;
+
+    const auto boys_arg = rho * coord::norm_squared(pos_p - pos_q);
+    elec::boys_all_orders_tabulated(boys_arg, boys_order_max, terms.ssss);
+
+    const auto expon_tot = 2.0 * M_PI * M_PI / (p * q) * std::sqrt(M_PI / (p + q));
+    const auto base_coefficient = prim_01.prefactor * prim_23.prefactor * expon_tot;
+    for (std::size_t m {0}; m <= boys_order_max; ++m) {
+        terms.ssss[m] *= base_coefficient;
+    }
+
+    return terms;
+}
+
+/*
+    The primitive integral [l0 l1|l2 l3]^(M), from the Obara-Saika recurrence relation
+
+    [a+1i b|cd]^(m) = PA_i [ab|cd]^(m) + WP_i [ab|cd]^(m+1)
+                    + a_i / (2p) ([a-1i b|cd]^(m) - (rho / p) [a-1i b|cd]^(m+1))
+                    + b_i / (2p) ([a b-1i|cd]^(m) - (rho / p) [a b-1i|cd]^(m+1))
+                    + c_i / (2(p + q)) [ab|c-1i d]^(m+1)
+                    + d_i / (2(p + q)) [ab|c d-1i]^(m+1)
+
+    and its counterparts for the other three centres. The angular momentum is taken off the centres
+    in order, so that by the time the ket is reached, the bra only holds s-orbitals.
+
+    Since no centre holds more than a single quantum, a_i is zero after stepping down from a, and
+    the remaining Kronecker deltas only check if two p-orbitals point in the same direction.
+*/
+template <std::int64_t L0, std::int64_t L1, std::int64_t L2, std::int64_t L3, std::size_t M>
+auto obara_saika(const PrimitiveQuartetTerms& t, const Directions& dirs) noexcept -> double
+{
+    static_assert(L0 <= 1 && L1 <= 1 && L2 <= 1 && L3 <= 1, "Only s- and p-orbitals are specialized.");
+
+    // clang-format off
+    if constexpr (L0 == 1) {
+        const auto i = dirs[0];
+        auto value = t.pa[i] * obara_saika<0, L1, L2, L3, M>(t, dirs) + t.wp[i] * obara_saika<0, L1, L2, L3, M + 1>(t, dirs);
+
+        if constexpr (L1 == 1) {
+            if (dirs[1] == i) {
+                value += t.one_over_2p * (obara_saika<0, 0, L2, L3, M>(t, dirs) - t.rho_over_p * obara_saika<0, 0, L2, L3, M + 1>(t, dirs));
+            }
+        }
+        if constexpr (L2 == 1) {
+            if (dirs[2] == i) {
+                value += t.one_over_2pq * obara_saika<0, L1, 0, L3, M + 1>(t, dirs);
+            }
+        }
+        if constexpr (L3 == 1) {
+            if (dirs[3] == i) {
+                value += t.one_over_2pq * obara_saika<0, L1, L2, 0, M + 1>(t, dirs);
+            }
+        }
+
+        return value;
+    }
+    else if constexpr (L1 == 1) {
+        const auto i = dirs[1];
+        auto value = t.pb[i] * obara_saika<0, 0, L2, L3, M>(t, dirs) + t.wp[i] * obara_saika<0, 0, L2, L3, M + 1>(t, dirs);
+
+        if constexpr (L2 == 1) {
+            if (dirs[2] == i) {
+                value += t.one_over_2pq * obara_saika<0, 0, 0, L3, M + 1>(t, dirs);
+            }
+        }
+        if constexpr (L3 == 1) {
+            if (dirs[3] == i) {
+                value += t.one_over_2pq * obara_saika<0, 0, L2, 0, M + 1>(t, dirs);
+            }
+        }
+
+        return value;
+    }
+    else if constexpr (L2 == 1) {
+        const auto i = dirs[2];
+        auto value = t.qc[i] * obara_saika<0, 0, 0, L3, M>(t, dirs) + t.wq[i] * obara_saika<0, 0, 0, L3, M + 1>(t, dirs);
+
+        if constexpr (L3 == 1) {
+            if (dirs[3] == i) {
+                value += t.one_over_2q * (obara_saika<0, 0, 0, 0, M>(t, dirs) - t.rho_over_q * obara_saika<0, 0, 0, 0, M + 1>(t, dirs));
+            }
+        }
+
+        return value;
+    }
+    else if constexpr (L3 == 1) {
+        const auto i = dirs[3];
+        return t.qd[i] * obara_saika<0, 0, 0, 0, M>(t, dirs) + t.wq[i] * obara_saika<0, 0, 0, 0, M + 1>(t, dirs);
+    }
+    else {
+        return t.ssss[M];
+    }
+    // clang-format on
+}
+
+template <std::int64_t L0, std::int64_t L1, std::int64_t L2, std::int64_t L3>
+auto electron_electron_integral_class(const elec::ShellPair& bra, const elec::ShellPair& ket) -> double
+{
+    constexpr auto boys_order_max = static_cast<std::size_t>(L0 + L1 + L2 + L3);
+
+    const auto dirs = Directions {
+        direction(bra.angmom0), direction(bra.angmom1), direction(ket.angmom0), direction(ket.angmom1)
+    };
+
+    auto output = double {0.0};
+    for (const auto& prim_01 : bra.primitives) {
+        for (const auto& prim_23 : ket.primitives) {
+            const auto terms = make_primitive_quartet_terms(bra, prim_01, ket, prim_23, boys_order_max);
+            const auto coeff = prim_01.coefficient * prim_23.coefficient;
+
+            output += coeff * obara_saika<L0, L1, L2, L3, 0>(terms, dirs);
+        }
+    }
+
+    return output;
+}
+
+using KernelFunction = double (*)(const elec::ShellPair&, const elec::ShellPair&);
+
+constexpr auto class_index(std::int64_t l0, std::int64_t l1, std::int64_t l2, std::int64_t l3) noexcept -> std::size_t
+{
+    constexpr auto n = static_cast<std::int64_t>(N_ANGULAR_MOMENTA_);
+    return static_cast<std::size_t>(((l0 * n + l1) * n + l2) * n + l3);
+}
+
+template <std::size_t INDEX>
+constexpr auto kernel_for_class_index() noexcept -> KernelFunction
+{
+    constexpr auto n = N_ANGULAR_MOMENTA_;
+    constexpr auto l0 = static_cast<std::int64_t>((INDEX / (n * n * n)) % n);
+    constexpr auto l1 = static_cast<std::int64_t>((INDEX / (n * n)) % n);
+    constexpr auto l2 = static_cast<std::int64_t>((INDEX / n) % n);
+    constexpr auto l3 = static_cast<std::int64_t>(INDEX % n);
+
+    return &electron_electron_integral_class<l0, l1, l2, l3>;
+}
+
+template <std::size_t... INDICES>
+constexpr auto make_kernel_table(std::index_sequence<INDICES...>) noexcept -> std::array<KernelFunction, N_KERNELS_>
+{
+    return {kernel_for_class_index<INDICES>()...};
+}
+
+constexpr auto KERNEL_TABLE = make_kernel_table(std::make_index_sequence<N_KERNELS_> {});
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto electron_electron_integral_specialized(const ShellPair& bra, const ShellPair& ket) -> double
+{
+    const auto l0 = total_angular_momentum(bra.angmom0);
+    const auto l1 = total_angular_momentum(bra.angmom1);
+    const auto l2 = total_angular_momentum(ket.angmom0);
+    const auto l3 = total_angular_momentum(ket.angmom1);
+
+    constexpr auto l_max = SPECIALIZED_MAX_ANGULAR_MOMENTUM;
+    if (l0 > l_max || l1 > l_max || l2 > l_max || l3 > l_max) {
+        return electron_electron_integral_head_gordon_pople(bra, ket);
+    }
+
+    return KERNEL_TABLE[class_index(l0, l1, l2, l3)](bra, ket);
+}
+
+}  // namespace elec
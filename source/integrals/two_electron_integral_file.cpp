@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+
+#include "elecstruct/integrals/two_electron_integral_file.hpp"
+
+namespace
+{
+
+constexpr auto FILE_MAGIC_ = std::array<char, 8> {'E', 'L', 'E', 'C', 'E', 'R', 'I', '1'};
+constexpr auto FILE_VERSION_ = std::uint64_t {1};
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint64_t version;
+    std::uint64_t n_basis_functions;
+    std::uint64_t n_records;
+};
+
+static_assert(sizeof(FileHeader) == 32, "The header must be tightly packed.");
+static_assert(sizeof(FileHeader) % alignof(elec::TwoElectronIntegralRecord) == 0);
+
+constexpr auto INDEX_BITS_ = std::uint64_t {16};
+constexpr auto INDEX_MASK_ = std::uint64_t {0xffff};
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto pack_quartet_indices(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) noexcept -> std::uint64_t
+{
+    // clang-format off
+    return (static_cast<std::uint64_t>(i0) << (3 * INDEX_BITS_))
+         | (static_cast<std::uint64_t>(i1) << (2 * INDEX_BITS_))
+         | (static_cast<std::uint64_t>(i2) << INDEX_BITS_)
+         |  static_cast<std::uint64_t>(i3);
+    // clang-format on
+}
+
+auto unpack_quartet_indices(std::uint64_t packed_indices) noexcept -> TwoElectronIntegralQuartet
+{
+    const auto i0 = static_cast<std::size_t>((packed_indices >> (3 * INDEX_BITS_)) & INDEX_MASK_);
+    const auto i1 = static_cast<std::size_t>((packed_indices >> (2 * INDEX_BITS_)) & INDEX_MASK_);
+    const auto i2 = static_cast<std::size_t>((packed_indices >> INDEX_BITS_) & INDEX_MASK_);
+    const auto i3 = static_cast<std::size_t>(packed_indices & INDEX_MASK_);
+
+    return {i0, i1, i2, i3};
+}
+
+// --- TwoElectronIntegralFileWriter
+
+TwoElectronIntegralFileWriter::TwoElectronIntegralFileWriter(
+    const std::filesystem::path& path,
+    std::size_t n_basis_functions
+)
+    : stream_ {path, std::ios::binary | std::ios::trunc}
+    , n_basis_functions_ {n_basis_functions}
+{
+    if (n_basis_functions > TWO_ELECTRON_INTEGRAL_FILE_MAX_BASIS_SIZE) {
+        throw std::runtime_error {"The basis is too large to be stored in a two-electron integral file."};
+    }
+
+    if (!stream_) {
+        throw std::runtime_error {"Failed to open the two-electron integral file '" + path.string() + "' for writing."};
+    }
+
+    // a placeholder, until the number of records is known
+    write_header_();
+    buffer_.reserve(RECORDS_PER_BLOCK);
+}
+
+TwoElectronIntegralFileWriter::~TwoElectronIntegralFileWriter()
+{
+    try {
+        close();
+    }
+    catch (...) {
+        // a destructor must not throw; call `close()` directly to see the error
+    }
+}
+
+void TwoElectronIntegralFileWriter::write(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double value)
+{
+    buffer_.push_back({pack_quartet_indices(i0, i1, i2, i3), value});
+    ++n_records_;
+
+    if (buffer_.size() == RECORDS_PER_BLOCK) {
+        flush_buffer_();
+    }
+}
+
+void TwoElectronIntegralFileWriter::close()
+{
+    if (!stream_.is_open()) {
+        return;
+    }
+
+    flush_buffer_();
+
+    stream_.seekp(0);
+    write_header_();
+    stream_.close();
+
+    if (stream_.fail()) {
+        throw std::runtime_error {"Failed to finish writing the two-electron integral file."};
+    }
+}
+
+auto TwoElectronIntegralFileWriter::n_records() const noexcept -> std::size_t
+{
+    return n_records_;
+}
+
+void TwoElectronIntegralFileWriter::flush_buffer_()
+{
+    const auto n_bytes = static_cast<std::streamsize>(buffer_.size() * sizeof(TwoElectronIntegralRecord));
+    stream_.write(reinterpret_cast<const char*>(buffer_.data()), n_bytes);  // NOLINT
+    buffer_.clear();
+
+    if (!stream_) {
+        throw std::runtime_error {"Failed to write a block of records to the two-electron integral file."};
+    }
+}
+
+void TwoElectronIntegralFileWriter::write_header_()
+{
+    const auto header = FileHeader {FILE_MAGIC_, FILE_VERSION_, n_basis_functions_, n_records_};
+    stream_.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));  // NOLINT
+}
+
+// --- TwoElectronIntegralFileReader
+
+TwoElectronIntegralFileReader::TwoElectronIntegralFileReader(const std::filesystem::path& path)
+{
+    const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
+        throw std::runtime_error {"Failed to open the two-electron integral file '" + path.string() + "'."};
+    }
+
+    struct stat file_status;
+    if (::fstat(file_descriptor, &file_status) != 0 || file_status.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(file_descriptor);
+        throw std::runtime_error {"The two-electron integral file '" + path.string() + "' is too small."};
+    }
+
+    mapping_size_ = static_cast<std::size_t>(file_status.st_size);
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+    // the mapping keeps its own reference to the file
+    ::close(file_descriptor);
+
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error {"Failed to map the two-electron integral file '" + path.string() + "'."};
+    }
+
+    // this is only a hint, so a failure is not an error
+    ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+
+    auto header = FileHeader {};
+    std::memcpy(&header, mapping_, sizeof(FileHeader));
+
+    const auto expected_size = sizeof(FileHeader) + header.n_records * sizeof(TwoElectronIntegralRecord);
+    if (header.magic != FILE_MAGIC_ || header.version != FILE_VERSION_ || expected_size != mapping_size_) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        throw std::runtime_error {"The file '" + path.string() + "' is not a valid two-electron integral file."};
+    }
+
+    n_basis_functions_ = static_cast<std::size_t>(header.n_basis_functions);
+
+    const auto* first_record = reinterpret_cast<const TwoElectronIntegralRecord*>(  // NOLINT
+        static_cast<const char*>(mapping_) + sizeof(FileHeader)
+    );
+    records_ = {first_record, static_cast<std::size_t>(header.n_records)};
+}
+
+TwoElectronIntegralFileReader::~TwoElectronIntegralFileReader()
+{
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+    }
+}
+
+auto TwoElectronIntegralFileReader::begin() const -> BlockIterator
+{
+    return BlockIterator {records_, 0};
+}
+
+auto TwoElectronIntegralFileReader::end() const -> BlockIterator
+{
+    return BlockIterator {records_, n_blocks()};
+}
+
+auto TwoElectronIntegralFileReader::n_basis_functions() const noexcept -> std::size_t
+{
+    return n_basis_functions_;
+}
+
+auto TwoElectronIntegralFileReader::n_records() const noexcept -> std::size_t
+{
+    return records_.size();
+}
+
+auto TwoElectronIntegralFileReader::n_blocks() const noexcept -> std::size_t
+{
+    return (records_.size() + RECORDS_PER_BLOCK - 1) / RECORDS_PER_BLOCK;
+}
+
+// --- TwoElectronIntegralFileReader::BlockIterator
+
+TwoElectronIntegralFileReader::BlockIterator::BlockIterator(
+    std::span<const TwoElectronIntegralRecord> records,
+    std::size_t i_block
+)
+    : records_ {records}
+    , i_block_ {i_block}
+{}
+
+auto TwoElectronIntegralFileReader::BlockIterator::operator*() const noexcept -> value_type
+{
+    const auto offset = i_block_ * RECORDS_PER_BLOCK;
+    const auto size = std::min(RECORDS_PER_BLOCK, records_.size() - offset);
+
+    return records_.subspan(offset, size);
+}
+
+auto TwoElectronIntegralFileReader::BlockIterator::operator++() noexcept -> BlockIterator&
+{
+    ++i_block_;
+    return *this;
+}
+
+auto TwoElectronIntegralFileReader::BlockIterator::operator++(int) noexcept -> BlockIterator
+{
+    auto temp = *this;
+    ++(*this);
+    return temp;
+}
+
+bool TwoElectronIntegralFileReader::BlockIterator::operator==(const BlockIterator& other) const noexcept
+{
+    return records_.data() == other.records_.data() && i_block_ == other.i_block_;
+}
+
+// --- writing a whole file
+
+auto write_two_electron_integral_file(
+    const std::filesystem::path& path,
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    ElectronElectronEngine engine
+) -> std::size_t
+{
+    const auto size = shell_pairs.n_basis_functions();
+
+    auto writer = TwoElectronIntegralFileWriter {path, size};
+    auto n_skipped = std::size_t {0};
+
+    for (const auto [i0, i1, i2, i3] : UniqueQuartetGenerator {size}) {
+        if (screening.is_negligible(i0, i1, i2, i3)) {
+            ++n_skipped;
+            continue;
+        }
+
+        const auto integral = electron_electron_integral(shell_pairs.get(i0, i1), shell_pairs.get(i2, i3), engine);
+        writer.write(i0, i1, i2, i3, integral);
+    }
+
+    writer.close();
+
+    return n_skipped;
+}
+
+}  // namespace elec
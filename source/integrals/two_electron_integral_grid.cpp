@@ -1,6 +1,10 @@
+#include <cassert>
 #include <cmath>
 #include <cstddef>
-#include <unordered_map>
+#include <limits>
+#include <span>
+
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
 
 #include "elecstruct/integrals/two_electron_integral_grid.hpp"
 
@@ -45,22 +49,27 @@ auto yoshimine_sort(std::size_t a, std::size_t b, std::size_t c, std::size_t d)
     return abcd;
 }
 
-/*
-    The TwoElectronIntegralGrid is a wrapper around a hashmap that converts the four indices
-    into a Yoshimine index before interfacing with the hashmap.
-*/
+TwoElectronIntegralGrid::TwoElectronIntegralGrid(std::size_t n_basis_functions)
+    : integrals_(n_unique_quartets(n_basis_functions), std::numeric_limits<double>::quiet_NaN())
+{}
+
 auto TwoElectronIntegralGrid::exists(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) const noexcept
     -> bool
 {
     const auto i_yoshimine = yoshimine_sort(i0, i1, i2, i3);
 
-    return integrals_.find(i_yoshimine) != integrals_.end();
+    return i_yoshimine < integrals_.size() && !std::isnan(integrals_[i_yoshimine]);
 }
 
-auto TwoElectronIntegralGrid::set(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double value) noexcept
-    -> void
+auto TwoElectronIntegralGrid::set(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double value) -> void
 {
     const auto i_yoshimine = yoshimine_sort(i0, i1, i2, i3);
+
+    // only a grid created without a basis size needs to grow
+    if (i_yoshimine >= integrals_.size()) {
+        integrals_.resize(i_yoshimine + 1, std::numeric_limits<double>::quiet_NaN());
+    }
+
     integrals_[i_yoshimine] = value;
 }
 
@@ -68,8 +77,24 @@ auto TwoElectronIntegralGrid::get(std::size_t i0, std::size_t i1, std::size_t i2
     -> double
 {
     const auto i_yoshimine = yoshimine_sort(i0, i1, i2, i3);
+    assert(i_yoshimine < integrals_.size());
+
+    return integrals_[i_yoshimine];
+}
 
-    return integrals_.at(i_yoshimine);
+auto TwoElectronIntegralGrid::size() const noexcept -> std::size_t
+{
+    return integrals_.size();
+}
+
+auto TwoElectronIntegralGrid::values() const noexcept -> std::span<const double>
+{
+    return {integrals_.data(), integrals_.size()};
+}
+
+auto TwoElectronIntegralGrid::values() noexcept -> std::span<double>
+{
+    return {integrals_.data(), integrals_.size()};
 }
 
 }  // namespace elec
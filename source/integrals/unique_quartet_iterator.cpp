@@ -0,0 +1,108 @@
+#include <cstddef>
+
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+
+namespace elec
+{
+
+// --- UniqueQuartetIterator
+
+UniqueQuartetIterator::UniqueQuartetIterator(std::size_t n_basis_functions)
+    : n_basis_functions_ {n_basis_functions}
+{}
+
+auto UniqueQuartetIterator::operator*() const noexcept -> value_type
+{
+    return TwoElectronIntegralQuartet {i0_, i1_, i2_, i3_};
+}
+
+auto UniqueQuartetIterator::operator->() const noexcept -> value_type
+{
+    return **this;
+}
+
+auto UniqueQuartetIterator::operator++() noexcept -> UniqueQuartetIterator&
+{
+    // once the ket pair reaches the bra pair, the ket pair's second index cannot exceed i1
+    const auto i3_max = (i2_ == i0_) ? i1_ : i2_;
+
+    ++i3_;
+    if (i3_ > i3_max) {
+        i3_ = 0;
+        ++i2_;
+
+        if (i2_ > i0_) {
+            i2_ = 0;
+            ++i1_;
+
+            if (i1_ > i0_) {
+                i1_ = 0;
+                ++i0_;
+            }
+        }
+    }
+
+    return *this;
+}
+
+auto UniqueQuartetIterator::operator++(int) noexcept -> UniqueQuartetIterator
+{
+    auto temp = *this;
+    ++(*this);
+    return temp;
+}
+
+void UniqueQuartetIterator::set_to_end() noexcept
+{
+    i0_ = n_basis_functions_;
+    i1_ = 0;
+    i2_ = 0;
+    i3_ = 0;
+}
+
+bool UniqueQuartetIterator::operator==(const UniqueQuartetIterator&) const noexcept = default;
+
+auto operator!=(const UniqueQuartetIterator& left, const UniqueQuartetIterator& right) noexcept -> bool
+{
+    return !(left == right);
+}
+
+// --- UniqueQuartetGenerator
+
+UniqueQuartetGenerator::UniqueQuartetGenerator(std::size_t n_basis_functions)
+    : n_basis_functions_ {n_basis_functions}
+{}
+
+auto UniqueQuartetGenerator::begin() noexcept -> UniqueQuartetIterator
+{
+    return UniqueQuartetIterator {n_basis_functions_};
+}
+
+auto UniqueQuartetGenerator::end() noexcept -> UniqueQuartetIterator
+{
+    auto iterator = UniqueQuartetIterator {n_basis_functions_};
+    iterator.set_to_end();
+
+    return iterator;
+}
+
+auto UniqueQuartetGenerator::begin() const noexcept -> UniqueQuartetIterator
+{
+    return UniqueQuartetIterator {n_basis_functions_};
+}
+
+auto UniqueQuartetGenerator::end() const noexcept -> UniqueQuartetIterator
+{
+    auto iterator = UniqueQuartetIterator {n_basis_functions_};
+    iterator.set_to_end();
+
+    return iterator;
+}
+
+auto n_unique_quartets(std::size_t n_basis_functions) noexcept -> std::size_t
+{
+    const auto n_pairs = n_basis_functions * (n_basis_functions + 1) / 2;
+    return n_pairs * (n_pairs + 1) / 2;
+}
+
+}  // namespace elec
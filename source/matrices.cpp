@@ -1,56 +1,265 @@
+#include <algorithm>
+#include <cstddef>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
 
 #include "elecstruct/atoms.hpp"
 #include "elecstruct/basis/basis.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
 #include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
 #include "elecstruct/integrals/kinetic_integrals.hpp"
 #include "elecstruct/integrals/nuclear_electron_integrals.hpp"
+#include "elecstruct/integrals/one_electron_integrals.hpp"
 #include "elecstruct/integrals/overlap_integrals.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/two_electron_integral_file.hpp"
 #include "elecstruct/integrals/two_electron_integral_grid.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/parallel/work_stealing.hpp"
 
 #include "elecstruct/matrices.hpp"
 
 namespace
 {
 
-// TODO: change coefficients of the integral so that they might be complex, since technically this is required
-auto electron_electron_integral(
-    const elec::AtomicOrbitalInfoSTO3G& orbital0,
-    const elec::AtomicOrbitalInfoSTO3G& orbital1,
-    const elec::AtomicOrbitalInfoSTO3G& orbital2,
-    const elec::AtomicOrbitalInfoSTO3G& orbital3
-) -> double
-{
-    const auto pos_gauss0 = orbital0.position;
-    const auto pos_gauss1 = orbital1.position;
-    const auto pos_gauss2 = orbital2.position;
-    const auto pos_gauss3 = orbital3.position;
-    const auto angmom_0 = orbital0.angular_momentum;
-    const auto angmom_1 = orbital1.angular_momentum;
-    const auto angmom_2 = orbital2.angular_momentum;
-    const auto angmom_3 = orbital3.angular_momentum;
-
-    // clang-format off
-    auto output = double {0.0};
-    for (const auto& info0 : orbital0.gaussians)
-    for (const auto& info1 : orbital1.gaussians)
-    for (const auto& info2 : orbital2.gaussians)
-    for (const auto& info3 : orbital3.gaussians) {
-        const auto coeff = info0.contraction_coeff * info1.contraction_coeff * info2.contraction_coeff * info3.contraction_coeff;
-        const auto integral = elec::electron_electron_integral_contraction(
-            angmom_0, angmom_1, angmom_2, angmom_3,
-            pos_gauss0, pos_gauss1, pos_gauss2, pos_gauss3,
-            info0.exponent_coeff, info1.exponent_coeff, info2.exponent_coeff, info3.exponent_coeff
-        );
-
-        output += coeff * integral;
+/*
+    A rough estimate of how much a shell pair contributes to the cost of an integral; the primitive
+    loops scale with the number of primitive pairs, and the index loops of each contraction grow with
+    the angular momenta.
+*/
+auto pair_cost_weight(const elec::ShellPair& pair) -> double
+{
+    const auto angmom0 = static_cast<double>(elec::total_angular_momentum(pair.angmom0));
+    const auto angmom1 = static_cast<double>(elec::total_angular_momentum(pair.angmom1));
+    return static_cast<double>(pair.primitives.size()) * (1.0 + angmom0) * (1.0 + angmom1);
+}
+
+/*
+    The ket pairs (i2 i3) that form a unique quartet with the bra pair (i0 i1); these all have
+    consecutive Yoshimine indices, and so each bra pair writes to its own contiguous block of the grid.
+*/
+template <typename Function>
+void for_each_unique_ket_pair(std::size_t i0, std::size_t i1, Function&& function)
+{
+    for (std::size_t i2 {0}; i2 <= i0; ++i2) {
+        const auto i3_max = (i2 == i0) ? i1 : i2;
+        for (std::size_t i3 {0}; i3 <= i3_max; ++i3) {
+            function(i2, i3);
+        }
     }
-    // clang-format on
+}
 
-    return output;
+/*
+    The number of distinct quartets that share the integral of the canonical quartet (i0 i1|i2 i3).
+*/
+auto quartet_degeneracy(std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3) noexcept -> double
+{
+    auto degeneracy = double {1.0};
+    if (i0 != i1) {
+        degeneracy *= 2.0;
+    }
+    if (i2 != i3) {
+        degeneracy *= 2.0;
+    }
+    if (i0 != i2 || i1 != i3) {
+        degeneracy *= 2.0;
+    }
+
+    return degeneracy;
+}
+
+/*
+    The Coulomb-type positions (i0 i1) and (i2 i3) that a canonical quartet contributes to; the weight
+    must already include the degeneracy of the quartet.
+*/
+void add_coulomb_type_contributions(
+    Eigen::MatrixXd& output,
+    const Eigen::MatrixXd& density_mtx,
+    Eigen::Index i0,
+    Eigen::Index i1,
+    Eigen::Index i2,
+    Eigen::Index i3,
+    double weight
+) noexcept
+{
+    output(i0, i1) += weight * density_mtx(i2, i3);
+    output(i2, i3) += weight * density_mtx(i0, i1);
+}
+
+/*
+    The exchange-type positions (i0 i2), (i1 i3), (i0 i3), and (i1 i2) that a canonical quartet
+    contributes to; the weight must already include the degeneracy of the quartet.
+*/
+void add_exchange_type_contributions(
+    Eigen::MatrixXd& output,
+    const Eigen::MatrixXd& density_mtx,
+    Eigen::Index i0,
+    Eigen::Index i1,
+    Eigen::Index i2,
+    Eigen::Index i3,
+    double weight
+) noexcept
+{
+    output(i0, i2) += weight * density_mtx(i1, i3);
+    output(i1, i3) += weight * density_mtx(i0, i2);
+    output(i0, i3) += weight * density_mtx(i1, i2);
+    output(i1, i2) += weight * density_mtx(i0, i3);
+}
+
+/*
+    Walks through the stored integrals and the canonical quartets together, in a single linear pass,
+    and calls `function(i0, i1, i2, i3, integral)` for each integral that is not zero; the integrals
+    of screened quartets are stored as zero, and contribute nothing.
+*/
+template <typename Function>
+void for_each_stored_unique_integral(
+    const elec::TwoElectronIntegralGrid& two_electron_integrals,
+    std::size_t n_basis_functions,
+    Function&& function
+)
+{
+    if (two_electron_integrals.size() != elec::n_unique_quartets(n_basis_functions)) {
+        throw std::runtime_error {"The two-electron integrals do not match the number of basis functions."};
+    }
+
+    const auto values = two_electron_integrals.values();
+
+    auto i_value = std::size_t {0};
+    for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {n_basis_functions}) {
+        const auto integral = values[i_value];
+        ++i_value;
+
+        if (integral == 0.0) {
+            continue;
+        }
+
+        function(i0, i1, i2, i3, integral);
+    }
+}
+
+/*
+    The one-electron matrices are built in square tiles of `ONE_ELECTRON_TILE_SIZE` basis functions
+    each, covering the upper triangle; the tiles on the diagonal only cover their own upper triangles.
+    Every element is calculated by exactly one tile, so the result is the same no matter which thread
+    calculates which tile, or in which order.
+*/
+constexpr auto ONE_ELECTRON_TILE_SIZE = std::size_t {16};
+
+auto n_one_electron_tiles(std::size_t size) -> std::size_t
+{
+    return (size + ONE_ELECTRON_TILE_SIZE - 1) / ONE_ELECTRON_TILE_SIZE;
+}
+
+/*
+    Calls `function(i0, i1)` for every pair of basis functions, with i0 <= i1, in the tile at
+    (`i_row_tile`, `i_col_tile`) of the upper triangle.
+*/
+template <typename Function>
+void for_each_pair_in_tile(std::size_t size, std::size_t i_row_tile, std::size_t i_col_tile, Function&& function)
+{
+    const auto row_begin = i_row_tile * ONE_ELECTRON_TILE_SIZE;
+    const auto row_end = std::min(size, row_begin + ONE_ELECTRON_TILE_SIZE);
+    const auto col_begin = i_col_tile * ONE_ELECTRON_TILE_SIZE;
+    const auto col_end = std::min(size, col_begin + ONE_ELECTRON_TILE_SIZE);
+
+    for (std::size_t i0 {row_begin}; i0 < row_end; ++i0) {
+        for (std::size_t i1 {std::max(i0, col_begin)}; i1 < col_end; ++i1) {
+            function(i0, i1);
+        }
+    }
+}
+
+/*
+    Fills both (i0, i1) and (i1, i0) of each one-electron matrix, for every pair in the tile; different
+    tiles never write to the same elements.
+*/
+void fill_one_electron_tile(
+    const elec::ShellPairData& shell_pairs,
+    std::span<const elec::PointCharge> nuclei,
+    std::size_t i_row_tile,
+    std::size_t i_col_tile,
+    elec::OneElectronMatrices& output
+)
+{
+    const auto size = shell_pairs.n_basis_functions();
+
+    for_each_pair_in_tile(size, i_row_tile, i_col_tile, [&](std::size_t i0, std::size_t i1) {
+        const auto integrals = elec::one_electron_integrals(shell_pairs.get(i0, i1), nuclei);
+
+        const auto row = static_cast<Eigen::Index>(i0);
+        const auto col = static_cast<Eigen::Index>(i1);
+
+        output.overlap_mtx(row, col) = integrals.overlap;
+        output.overlap_mtx(col, row) = integrals.overlap;
+        output.kinetic_mtx(row, col) = integrals.kinetic;
+        output.kinetic_mtx(col, row) = integrals.kinetic;
+        output.nuclear_electron_mtx(row, col) = integrals.nuclear_electron;
+        output.nuclear_electron_mtx(col, row) = integrals.nuclear_electron;
+
+        // the orbitals are normalized, so the diagonal of the overlap matrix is 1.0, the same as
+        // what `overlap_matrix()` gives
+        if (i0 == i1) {
+            output.overlap_mtx(row, row) = 1.0;
+        }
+    });
+}
+
+auto empty_one_electron_matrices(std::size_t size) -> elec::OneElectronMatrices
+{
+    const auto n_rows = static_cast<Eigen::Index>(size);
+
+    return elec::OneElectronMatrices {
+        Eigen::MatrixXd {n_rows, n_rows},
+        Eigen::MatrixXd {n_rows, n_rows},
+        Eigen::MatrixXd {n_rows, n_rows}
+    };
+}
+
+auto symmetrized(const Eigen::MatrixXd& matrix) -> Eigen::MatrixXd
+{
+    return (0.5 * (matrix + matrix.transpose())).eval();
+}
+
+/*
+    The in-place builders write into matrices that were allocated up front; they throw instead of resizing
+    a matrix of the wrong size, so that an allocation never happens silently.
+*/
+void check_matrix_size(const Eigen::MatrixXd& matrix, Eigen::Index size, const char* name)
+{
+    if (matrix.rows() != size || matrix.cols() != size) {
+        throw std::runtime_error {std::string {"The "} + name + " does not match the number of basis functions."};
+    }
+}
+
+/*
+    F = H + 0.5 * (G + G^T), evaluated element by element straight into the Fock matrix; the arithmetic
+    is the same as that of `core_hamiltonian_mtx + symmetrized(electron_electron_mtx)`.
+*/
+void assign_fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& core_hamiltonian_mtx,
+    const Eigen::MatrixXd& electron_electron_mtx
+)
+{
+    fock_mtx = core_hamiltonian_mtx + 0.5 * (electron_electron_mtx + electron_electron_mtx.transpose());
+}
+
+auto square_density_matrix_size(const Eigen::MatrixXd& density_matrix) -> std::size_t
+{
+    if (density_matrix.rows() != density_matrix.cols()) {
+        throw std::runtime_error {"The density matrix must be square."};
+    }
+
+    return static_cast<std::size_t>(density_matrix.rows());
 }
 
 }  // anonymous namespace
@@ -60,7 +269,12 @@ namespace elec
 
 auto overlap_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> Eigen::MatrixXd
 {
-    const auto size = basis.size();
+    return overlap_matrix(ShellPairData {basis});
+}
+
+auto overlap_matrix(const ShellPairData& shell_pairs) -> Eigen::MatrixXd
+{
+    const auto size = shell_pairs.n_basis_functions();
 
     auto output = Eigen::MatrixXd {size, size};
 
@@ -73,25 +287,8 @@ auto overlap_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> Eigen::
     //   - the overlap matrix is Hermitian
     //   - we are working with real coefficients, which means the matrix is symmetric
     for (std::size_t i0 {0}; i0 < size - 1; ++i0) {
-        const auto& basis0 = basis[i0];
-        const auto pos0 = basis0.position;
-        const auto angmom_0 = basis0.angular_momentum;
         for (std::size_t i1 {i0 + 1}; i1 < size; ++i1) {
-            const auto& basis1 = basis[i1];
-            const auto pos1 = basis1.position;
-            const auto angmom_1 = basis1.angular_momentum;
-
-            auto element = double {0.0};
-            for (const auto info0 : basis0.gaussians) {
-                for (const auto info1 : basis1.gaussians) {
-                    const auto coeff = info0.contraction_coeff * info1.contraction_coeff;
-                    const auto overlap = overlap_integral_contraction(
-                        angmom_0, angmom_1, pos0, pos1, info0.exponent_coeff, info1.exponent_coeff
-                    );
-
-                    element += coeff * overlap;
-                }
-            }
+            const auto element = overlap_integral(shell_pairs.get(i0, i1));
 
             const auto i0_eig = static_cast<Eigen::Index>(i0);
             const auto i1_eig = static_cast<Eigen::Index>(i1);
@@ -135,29 +332,18 @@ auto transformation_matrix(const Eigen::MatrixXd& s_overlap) -> Eigen::MatrixXd
 
 auto kinetic_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> Eigen::MatrixXd
 {
-    const auto size = basis.size();
+    return kinetic_matrix(ShellPairData {basis});
+}
+
+auto kinetic_matrix(const ShellPairData& shell_pairs) -> Eigen::MatrixXd
+{
+    const auto size = shell_pairs.n_basis_functions();
 
     auto output = Eigen::MatrixXd {size, size};
 
     for (std::size_t i0 {0}; i0 < size; ++i0) {
-        const auto& basis0 = basis[i0];
-        const auto pos0 = basis0.position;
-        const auto angmom_0 = basis0.angular_momentum;
         for (std::size_t i1 {i0}; i1 < size; ++i1) {
-            const auto& basis1 = basis[i1];
-            const auto pos1 = basis1.position;
-            const auto angmom_1 = basis1.angular_momentum;
-
-            auto element = double {0.0};
-            for (const auto info0 : basis0.gaussians) {
-                for (const auto info1 : basis1.gaussians) {
-                    const auto coeff = info0.contraction_coeff * info1.contraction_coeff;
-                    const auto overlap = kinetic_integral_contraction(
-                        angmom_0, angmom_1, pos0, pos1, info0.exponent_coeff, info1.exponent_coeff
-                    );
-                    element += coeff * overlap;
-                }
-            }
+            const auto element = kinetic_integral(shell_pairs.get(i0, i1));
 
             const auto i0_eig = static_cast<Eigen::Index>(i0);
             const auto i1_eig = static_cast<Eigen::Index>(i1);
@@ -171,35 +357,19 @@ auto kinetic_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> Eigen::
 
 auto nuclear_electron_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, const AtomInfo& atom) -> Eigen::MatrixXd
 {
-    const auto size = basis.size();
+    return nuclear_electron_matrix(ShellPairData {basis}, atom);
+}
+
+auto nuclear_electron_matrix(const ShellPairData& shell_pairs, const AtomInfo& atom) -> Eigen::MatrixXd
+{
+    const auto size = shell_pairs.n_basis_functions();
     const auto charge = nuclear_charge(atom.label);
 
     auto output = Eigen::MatrixXd {size, size};
 
-    // clang-format off
     for (std::size_t i0 {0}; i0 < size; ++i0) {
-        const auto& basis0 = basis[i0];
-        const auto pos0 = basis0.position;
-        const auto angmom_0 = basis0.angular_momentum;
         for (std::size_t i1 {i0}; i1 < size; ++i1) {
-            const auto& basis1 = basis[i1];
-            const auto pos1 = basis1.position;
-            const auto angmom_1 = basis1.angular_momentum;
-
-            auto element = double {0.0};
-            for (const auto info0 : basis0.gaussians) {
-                for (const auto info1 : basis1.gaussians) {
-                    const auto coeff = info0.contraction_coeff * info1.contraction_coeff;
-                    const auto overlap = nuclear_electron_integral_contraction(
-                        angmom_0, angmom_1,
-                        pos0, pos1, atom.position,
-                        info0.exponent_coeff, info1.exponent_coeff,
-                        charge
-                    );
-
-                    element += coeff * overlap;
-                }
-            }
+            const auto element = nuclear_electron_integral(shell_pairs.get(i0, i1), atom.position, charge);
 
             const auto i0_eig = static_cast<Eigen::Index>(i0);
             const auto i1_eig = static_cast<Eigen::Index>(i1);
@@ -207,7 +377,6 @@ auto nuclear_electron_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, c
             output(i1_eig, i0_eig) = element;
         }
     }
-    // clang-format on
 
     return output;
 }
@@ -219,38 +388,192 @@ auto nuclear_electron_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, c
 auto core_hamiltonian_matrix(const std::vector<AtomicOrbitalInfoSTO3G>& basis, const std::vector<AtomInfo>& atoms)
     -> Eigen::MatrixXd
 {
-    auto output = kinetic_matrix(basis);
+    return core_hamiltonian_matrix(ShellPairData {basis}, atoms);
+}
+
+auto core_hamiltonian_matrix(const ShellPairData& shell_pairs, const std::vector<AtomInfo>& atoms) -> Eigen::MatrixXd
+{
+    const auto matrices = one_electron_matrices(shell_pairs, atoms);
+
+    return matrices.kinetic_mtx + matrices.nuclear_electron_mtx;
+}
+
+auto one_electron_matrices(const ShellPairData& shell_pairs, const std::vector<AtomInfo>& atoms)
+    -> OneElectronMatrices
+{
+    const auto size = shell_pairs.n_basis_functions();
+    const auto n_tiles = n_one_electron_tiles(size);
+    const auto nuclei = point_charges(atoms);
+
+    auto output = empty_one_electron_matrices(size);
+
+    for (std::size_t i_row_tile {0}; i_row_tile < n_tiles; ++i_row_tile) {
+        for (std::size_t i_col_tile {i_row_tile}; i_col_tile < n_tiles; ++i_col_tile) {
+            fill_one_electron_tile(shell_pairs, nuclei, i_row_tile, i_col_tile, output);
+        }
+    }
+
+    return output;
+}
+
+auto one_electron_matrices(const ShellPairData& shell_pairs, const std::vector<AtomInfo>& atoms, std::size_t n_threads)
+    -> OneElectronMatrices
+{
+    const auto size = shell_pairs.n_basis_functions();
+    const auto n_tiles = n_one_electron_tiles(size);
+    const auto nuclei = point_charges(atoms);
+
+    auto output = empty_one_electron_matrices(size);
+
+    auto tasks = std::vector<parallel::WeightedTask> {};
+    tasks.reserve(n_tiles * (n_tiles + 1) / 2);
+
+    for (std::size_t i_row_tile {0}; i_row_tile < n_tiles; ++i_row_tile) {
+        for (std::size_t i_col_tile {i_row_tile}; i_col_tile < n_tiles; ++i_col_tile) {
+            // every pair loops over the same nuclei, so the number of nuclei does not change the
+            // relative costs of the tiles
+            auto cost = double {0.0};
+            for_each_pair_in_tile(size, i_row_tile, i_col_tile, [&](std::size_t i0, std::size_t i1) {
+                cost += pair_cost_weight(shell_pairs.get(i0, i1));
+            });
+
+            auto work = [&, i_row_tile, i_col_tile]()
+            { fill_one_electron_tile(shell_pairs, nuclei, i_row_tile, i_col_tile, output); };
 
-    for (const auto& atom : atoms) {
-        const auto nuclear_mtx = nuclear_electron_matrix(basis, atom);
-        output += nuclear_mtx;
+            tasks.push_back({cost, std::move(work)});
+        }
     }
 
+    parallel::run_work_stealing(std::move(tasks), n_threads);
+
     return output;
 }
 
 /*
-    NOTE: I'm pretty sure exchanging i0 <-> i1, and i2 <-> i3, only change the result by a complex
-    conjugate; once I get the code running, I should take advantage of that symmetry
+    The two-electron integrals are unchanged by the swaps (i0 <-> i1), (i2 <-> i3), and
+    (i0 i1) <-> (i2 i3) of the basis function indices; only the symmetry-unique quartets are
+    calculated, and the rest are recovered through the Yoshimine index of the grid.
 */
 auto two_electron_integral_grid(const std::vector<AtomicOrbitalInfoSTO3G>& basis) -> TwoElectronIntegralGrid
 {
-    const auto size = basis.size();
-    auto integral_grid = TwoElectronIntegralGrid {};
+    return two_electron_integral_grid(ShellPairData {basis});
+}
 
-    for (std::size_t i0 {0}; i0 < size; ++i0)
-        for (std::size_t i1 {0}; i1 < size; ++i1)
-            for (std::size_t i2 {0}; i2 < size; ++i2)
-                for (std::size_t i3 {0}; i3 < size; ++i3) {
-                    if (!integral_grid.exists(i0, i1, i2, i3)) {
-                        const auto integral = electron_electron_integral(basis[i0], basis[i1], basis[i2], basis[i3]);
-                        integral_grid.set(i0, i1, i2, i3, integral);
-                    }
-                }
+auto two_electron_integral_grid(const ShellPairData& shell_pairs, ElectronElectronEngine engine)
+    -> TwoElectronIntegralGrid
+{
+    const auto size = shell_pairs.n_basis_functions();
+
+    auto integral_grid = TwoElectronIntegralGrid {size};
+
+    for (const auto [i0, i1, i2, i3] : UniqueQuartetGenerator {size}) {
+        const auto integral = electron_electron_integral(shell_pairs.get(i0, i1), shell_pairs.get(i2, i3), engine);
+        integral_grid.set(i0, i1, i2, i3, integral);
+    }
 
     return integral_grid;
 }
 
+auto screened_two_electron_integral_grid(
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    const SchwarzScreening& screening
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>
+{
+    return screened_two_electron_integral_grid(ShellPairData {basis}, screening);
+}
+
+auto screened_two_electron_integral_grid(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    ElectronElectronEngine engine
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>
+{
+    const auto size = shell_pairs.n_basis_functions();
+
+    auto integral_grid = TwoElectronIntegralGrid {size};
+    auto n_skipped = std::size_t {0};
+
+    for (const auto [i0, i1, i2, i3] : UniqueQuartetGenerator {size}) {
+        if (screening.is_negligible(i0, i1, i2, i3)) {
+            integral_grid.set(i0, i1, i2, i3, 0.0);
+            ++n_skipped;
+            continue;
+        }
+
+        const auto integral = electron_electron_integral(shell_pairs.get(i0, i1), shell_pairs.get(i2, i3), engine);
+        integral_grid.set(i0, i1, i2, i3, integral);
+    }
+
+    return {integral_grid, n_skipped};
+}
+
+auto screened_two_electron_integral_grid(
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    const SchwarzScreening& screening,
+    std::size_t n_threads
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>
+{
+    return screened_two_electron_integral_grid(ShellPairData {basis}, screening, n_threads);
+}
+
+auto screened_two_electron_integral_grid(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    std::size_t n_threads,
+    ElectronElectronEngine engine
+) -> std::tuple<TwoElectronIntegralGrid, std::size_t>
+{
+    const auto size = shell_pairs.n_basis_functions();
+    const auto n_pairs = size * (size + 1) / 2;
+
+    auto integral_grid = TwoElectronIntegralGrid {size};
+
+    // each task only ever writes to its own elements, so no synchronization is needed
+    auto n_skipped_per_pair = std::vector<std::size_t>(n_pairs, 0);
+
+    auto tasks = std::vector<parallel::WeightedTask> {};
+    tasks.reserve(n_pairs);
+
+    for (std::size_t i0 {0}; i0 < size; ++i0) {
+        for (std::size_t i1 {0}; i1 <= i0; ++i1) {
+            auto ket_cost = double {0.0};
+            for_each_unique_ket_pair(i0, i1, [&](std::size_t i2, std::size_t i3) {
+                ket_cost += pair_cost_weight(shell_pairs.get(i2, i3));
+            });
+
+            const auto cost = pair_cost_weight(shell_pairs.get(i0, i1)) * ket_cost;
+            const auto i_pair = i0 * (i0 + 1) / 2 + i1;
+
+            auto work = [&, i0, i1, i_pair]()
+            {
+                for_each_unique_ket_pair(i0, i1, [&](std::size_t i2, std::size_t i3) {
+                    if (screening.is_negligible(i0, i1, i2, i3)) {
+                        integral_grid.set(i0, i1, i2, i3, 0.0);
+                        ++n_skipped_per_pair[i_pair];
+                        return;
+                    }
+
+                    const auto& bra = shell_pairs.get(i0, i1);
+                    const auto& ket = shell_pairs.get(i2, i3);
+                    const auto integral = electron_electron_integral(bra, ket, engine);
+                    integral_grid.set(i0, i1, i2, i3, integral);
+                });
+            };
+
+            tasks.push_back({cost, std::move(work)});
+        }
+    }
+
+    parallel::run_work_stealing(std::move(tasks), n_threads);
+
+    auto n_skipped = std::size_t {0};
+    for (const auto n_skipped_pair : n_skipped_per_pair) {
+        n_skipped += n_skipped_pair;
+    }
+
+    return {integral_grid, n_skipped};
+}
+
 /*
     NOTE: the density elements are actually given by the sum of:
         `coefficient_mtx(i0, j)` * CONJUGATE(coefficient_mtx(i1, j))`;
@@ -262,24 +585,35 @@ auto density_matrix_restricted_hartree_fock(const Eigen::MatrixXd& coefficient_m
     -> Eigen::MatrixXd
 {
     const auto size = coefficient_mtx.cols();
-    const auto half = static_cast<Eigen::Index>(n_electrons / 2);
 
     auto output = Eigen::MatrixXd {size, size};
+    density_matrix_restricted_hartree_fock(output, coefficient_mtx, n_electrons);
 
-    for (Eigen::Index i0 {0}; i0 < size; ++i0) {
-        for (Eigen::Index i1 {i0}; i1 < size; ++i1) {
-            auto density_element = double {0.0};
-            for (Eigen::Index j {0}; j < half; ++j) {
-                density_element += coefficient_mtx(i0, j) * coefficient_mtx(i1, j);
-            }
+    return output;
+}
 
-            const auto result = 2.0 * density_element;
-            output(i0, i1) = result;
-            output(i1, i0) = result;
-        }
+void density_matrix_restricted_hartree_fock(
+    Eigen::MatrixXd& density_mtx,
+    const Eigen::MatrixXd& coefficient_mtx,
+    std::size_t n_electrons
+)
+{
+    const auto size = coefficient_mtx.cols();
+    const auto n_occupied = static_cast<Eigen::Index>(n_electrons / 2);
+
+    check_matrix_size(density_mtx, size, "density matrix");
+    if (n_occupied > size) {
+        throw std::runtime_error {"There are more occupied orbitals than basis functions."};
     }
 
-    return output;
+    // D = 2 C_occ C_occ^T is a symmetric rank-k update; only the lower triangle is calculated, and then
+    // copied into the upper triangle
+    density_mtx.setZero();
+    density_mtx.selfadjointView<Eigen::Lower>().rankUpdate(coefficient_mtx.leftCols(n_occupied), 2.0);
+
+    for (Eigen::Index i {1}; i < size; ++i) {
+        density_mtx.col(i).head(i) = density_mtx.row(i).head(i).transpose();
+    }
 }
 
 auto electron_electron_matrix(
@@ -288,34 +622,167 @@ auto electron_electron_matrix(
     const TwoElectronIntegralGrid& two_electron_integrals
 ) -> Eigen::MatrixXd
 {
-    const auto size = basis.size();
-    auto output = Eigen::MatrixXd {size, size};
+    const auto size = static_cast<Eigen::Index>(basis.size());
+    auto output = Eigen::MatrixXd::Zero(size, size).eval();
 
-    for (std::size_t i0 {0}; i0 < size; ++i0) {
-        for (std::size_t i1 {0}; i1 < size; ++i1) {
-            auto element = double {0.0};
-            for (std::size_t i2 {0}; i2 < size; ++i2) {
-                for (std::size_t i3 {0}; i3 < size; ++i3) {
-                    const auto i2_eig = static_cast<Eigen::Index>(i2);
-                    const auto i3_eig = static_cast<Eigen::Index>(i3);
-                    const auto density_part = density_matrix(i2_eig, i3_eig);
-
-                    const auto coulombic_term = two_electron_integrals.get(i0, i1, i2, i3);
-                    const auto exchange_term = two_electron_integrals.get(i0, i3, i2, i1);
-                    const auto electron_part = coulombic_term - 0.5 * exchange_term;
-
-                    element += density_part * electron_part;
-                }
-            }
+    const auto add_contributions = [&](std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double integral)
+    { add_unique_integral_contributions(output, density_matrix, i0, i1, i2, i3, integral); };
 
-            const auto i0_eig = static_cast<Eigen::Index>(i0);
-            const auto i1_eig = static_cast<Eigen::Index>(i1);
-            output(i0_eig, i1_eig) = element;
-            output(i1_eig, i0_eig) = element;
+    for_each_stored_unique_integral(two_electron_integrals, basis.size(), add_contributions);
+
+    return symmetrized(output);
+}
+
+auto coulomb_exchange_matrices(
+    const Eigen::MatrixXd& density_matrix,
+    const TwoElectronIntegralGrid& two_electron_integrals
+) -> CoulombExchangeMatrices
+{
+    const auto size = square_density_matrix_size(density_matrix);
+    const auto size_eig = static_cast<Eigen::Index>(size);
+
+    auto coulomb_mtx = Eigen::MatrixXd::Zero(size_eig, size_eig).eval();
+    auto exchange_mtx = Eigen::MatrixXd::Zero(size_eig, size_eig).eval();
+
+    const auto add_contributions = [&](std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double integral)
+    {
+        const auto degeneracy = quartet_degeneracy(i0, i1, i2, i3);
+
+        const auto i0_eig = static_cast<Eigen::Index>(i0);
+        const auto i1_eig = static_cast<Eigen::Index>(i1);
+        const auto i2_eig = static_cast<Eigen::Index>(i2);
+        const auto i3_eig = static_cast<Eigen::Index>(i3);
+
+        const auto coulomb_weight = 0.5 * degeneracy * integral;
+        const auto exchange_weight = 0.25 * degeneracy * integral;
+
+        add_coulomb_type_contributions(coulomb_mtx, density_matrix, i0_eig, i1_eig, i2_eig, i3_eig, coulomb_weight);
+        add_exchange_type_contributions(exchange_mtx, density_matrix, i0_eig, i1_eig, i2_eig, i3_eig, exchange_weight);
+    };
+
+    for_each_stored_unique_integral(two_electron_integrals, size, add_contributions);
+
+    return {symmetrized(coulomb_mtx), symmetrized(exchange_mtx)};
+}
+
+auto coulomb_matrix(const Eigen::MatrixXd& density_matrix, const TwoElectronIntegralGrid& two_electron_integrals)
+    -> Eigen::MatrixXd
+{
+    const auto size = square_density_matrix_size(density_matrix);
+    const auto size_eig = static_cast<Eigen::Index>(size);
+
+    auto coulomb_mtx = Eigen::MatrixXd::Zero(size_eig, size_eig).eval();
+
+    const auto add_contributions = [&](std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double integral)
+    {
+        const auto weight = 0.5 * quartet_degeneracy(i0, i1, i2, i3) * integral;
+
+        const auto i0_eig = static_cast<Eigen::Index>(i0);
+        const auto i1_eig = static_cast<Eigen::Index>(i1);
+        const auto i2_eig = static_cast<Eigen::Index>(i2);
+        const auto i3_eig = static_cast<Eigen::Index>(i3);
+
+        add_coulomb_type_contributions(coulomb_mtx, density_matrix, i0_eig, i1_eig, i2_eig, i3_eig, weight);
+    };
+
+    for_each_stored_unique_integral(two_electron_integrals, size, add_contributions);
+
+    return symmetrized(coulomb_mtx);
+}
+
+auto exchange_matrix(const Eigen::MatrixXd& density_matrix, const TwoElectronIntegralGrid& two_electron_integrals)
+    -> Eigen::MatrixXd
+{
+    const auto size = square_density_matrix_size(density_matrix);
+    const auto size_eig = static_cast<Eigen::Index>(size);
+
+    auto exchange_mtx = Eigen::MatrixXd::Zero(size_eig, size_eig).eval();
+
+    const auto add_contributions = [&](std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double integral)
+    {
+        const auto weight = 0.25 * quartet_degeneracy(i0, i1, i2, i3) * integral;
+
+        const auto i0_eig = static_cast<Eigen::Index>(i0);
+        const auto i1_eig = static_cast<Eigen::Index>(i1);
+        const auto i2_eig = static_cast<Eigen::Index>(i2);
+        const auto i3_eig = static_cast<Eigen::Index>(i3);
+
+        add_exchange_type_contributions(exchange_mtx, density_matrix, i0_eig, i1_eig, i2_eig, i3_eig, weight);
+    };
+
+    for_each_stored_unique_integral(two_electron_integrals, size, add_contributions);
+
+    return symmetrized(exchange_mtx);
+}
+
+auto coulomb_exchange_matrices(
+    const Eigen::MatrixXd& density_matrix,
+    const FactorizedTwoElectronIntegrals& factorized_integrals
+) -> CoulombExchangeMatrices
+{
+    auto coulomb_mtx = factorized_integrals.coulomb_matrix(density_matrix);
+    auto exchange_mtx = factorized_integrals.exchange_matrix(density_matrix);
+
+    return {std::move(coulomb_mtx), std::move(exchange_mtx)};
+}
+
+auto electron_electron_matrix(
+    const FactorizedTwoElectronIntegrals& factorized_integrals,
+    const Eigen::MatrixXd& density_matrix
+) -> Eigen::MatrixXd
+{
+    const auto [coulomb_mtx, exchange_mtx] = coulomb_exchange_matrices(density_matrix, factorized_integrals);
+
+    return symmetrized(coulomb_mtx - 0.5 * exchange_mtx);
+}
+
+void add_unique_integral_contributions(
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& density_matrix,
+    std::size_t i0,
+    std::size_t i1,
+    std::size_t i2,
+    std::size_t i3,
+    double integral
+) noexcept
+{
+    const auto degeneracy = quartet_degeneracy(i0, i1, i2, i3);
+
+    const auto i0_eig = static_cast<Eigen::Index>(i0);
+    const auto i1_eig = static_cast<Eigen::Index>(i1);
+    const auto i2_eig = static_cast<Eigen::Index>(i2);
+    const auto i3_eig = static_cast<Eigen::Index>(i3);
+
+    // G = J - 0.5 K
+    const auto coulomb_weight = 0.5 * degeneracy * integral;
+    const auto exchange_weight = -0.125 * degeneracy * integral;
+
+    auto& g_mtx = electron_electron_mtx;
+    add_coulomb_type_contributions(g_mtx, density_matrix, i0_eig, i1_eig, i2_eig, i3_eig, coulomb_weight);
+    add_exchange_type_contributions(g_mtx, density_matrix, i0_eig, i1_eig, i2_eig, i3_eig, exchange_weight);
+}
+
+auto electron_electron_matrix(
+    const TwoElectronIntegralFileReader& integral_file,
+    const Eigen::MatrixXd& density_matrix
+) -> Eigen::MatrixXd
+{
+    const auto size = static_cast<Eigen::Index>(integral_file.n_basis_functions());
+
+    if (density_matrix.rows() != size || density_matrix.cols() != size) {
+        throw std::runtime_error {"The density matrix does not match the number of basis functions."};
+    }
+
+    auto output = Eigen::MatrixXd::Zero(size, size).eval();
+
+    for (const auto block : integral_file) {
+        for (const auto& record : block) {
+            const auto [i0, i1, i2, i3] = unpack_quartet_indices(record.packed_indices);
+            add_unique_integral_contributions(output, density_matrix, i0, i1, i2, i3, record.value);
         }
     }
 
-    return output;
+    return symmetrized(output);
 }
 
 auto fock_matrix(
@@ -331,4 +798,103 @@ auto fock_matrix(
     return fock_mtx;
 }
 
+auto fock_matrix(
+    const Eigen::MatrixXd& old_density_mtx,
+    const TwoElectronIntegralFileReader& integral_file,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+) -> Eigen::MatrixXd
+{
+    const auto electron_electron_mtx = electron_electron_matrix(integral_file, old_density_mtx);
+    const auto fock_mtx = core_hamiltonian_mtx + electron_electron_mtx;
+
+    return fock_mtx;
+}
+
+auto fock_matrix(
+    const Eigen::MatrixXd& old_density_mtx,
+    const FactorizedTwoElectronIntegrals& factorized_integrals,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+) -> Eigen::MatrixXd
+{
+    const auto electron_electron_mtx = electron_electron_matrix(factorized_integrals, old_density_mtx);
+    const auto fock_mtx = core_hamiltonian_mtx + electron_electron_mtx;
+
+    return fock_mtx;
+}
+
+void fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& old_density_mtx,
+    const TwoElectronIntegralGrid& two_electron_integrals,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+)
+{
+    const auto n_basis_functions = square_density_matrix_size(old_density_mtx);
+    const auto size = static_cast<Eigen::Index>(n_basis_functions);
+
+    check_matrix_size(fock_mtx, size, "Fock matrix");
+    check_matrix_size(electron_electron_mtx, size, "electron-electron matrix");
+    check_matrix_size(core_hamiltonian_mtx, size, "core Hamiltonian matrix");
+
+    electron_electron_mtx.setZero();
+
+    const auto add_contributions = [&](std::size_t i0, std::size_t i1, std::size_t i2, std::size_t i3, double integral)
+    { add_unique_integral_contributions(electron_electron_mtx, old_density_mtx, i0, i1, i2, i3, integral); };
+
+    for_each_stored_unique_integral(two_electron_integrals, n_basis_functions, add_contributions);
+
+    assign_fock_matrix(fock_mtx, core_hamiltonian_mtx, electron_electron_mtx);
+}
+
+void fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& old_density_mtx,
+    const TwoElectronIntegralFileReader& integral_file,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+)
+{
+    const auto size = static_cast<Eigen::Index>(integral_file.n_basis_functions());
+
+    check_matrix_size(old_density_mtx, size, "density matrix");
+    check_matrix_size(fock_mtx, size, "Fock matrix");
+    check_matrix_size(electron_electron_mtx, size, "electron-electron matrix");
+    check_matrix_size(core_hamiltonian_mtx, size, "core Hamiltonian matrix");
+
+    electron_electron_mtx.setZero();
+
+    for (const auto block : integral_file) {
+        for (const auto& record : block) {
+            const auto [i0, i1, i2, i3] = unpack_quartet_indices(record.packed_indices);
+            add_unique_integral_contributions(electron_electron_mtx, old_density_mtx, i0, i1, i2, i3, record.value);
+        }
+    }
+
+    assign_fock_matrix(fock_mtx, core_hamiltonian_mtx, electron_electron_mtx);
+}
+
+void fock_matrix(
+    Eigen::MatrixXd& fock_mtx,
+    Eigen::MatrixXd& electron_electron_mtx,
+    const Eigen::MatrixXd& old_density_mtx,
+    const FactorizedTwoElectronIntegrals& factorized_integrals,
+    const Eigen::MatrixXd& core_hamiltonian_mtx
+)
+{
+    const auto size = static_cast<Eigen::Index>(factorized_integrals.n_basis_functions());
+
+    check_matrix_size(core_hamiltonian_mtx, size, "core Hamiltonian matrix");
+
+    // the Fock matrix holds the exchange matrix until G = J - 0.5 K has been formed from it
+    auto& coulomb_mtx = electron_electron_mtx;
+    auto& exchange_mtx = fock_mtx;
+    factorized_integrals.coulomb_matrix(coulomb_mtx, old_density_mtx);
+    factorized_integrals.exchange_matrix(exchange_mtx, old_density_mtx);
+
+    electron_electron_mtx -= 0.5 * exchange_mtx;
+
+    assign_fock_matrix(fock_mtx, core_hamiltonian_mtx, electron_electron_mtx);
+}
+
 }  // namespace elec
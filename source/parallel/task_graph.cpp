@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "elecstruct/parallel/task_graph.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+auto seconds_between(Clock::time_point start, Clock::time_point end) -> double
+{
+    return std::chrono::duration<double> {end - start}.count();
+}
+
+}  // anonymous namespace
+
+namespace elec::parallel
+{
+
+auto TaskGraph::add(std::string name, std::function<void()> work, const std::vector<NodeId>& dependencies) -> NodeId
+{
+    const auto id = nodes_.size();
+
+    for (const auto dependency : dependencies) {
+        if (dependency >= id) {
+            throw std::runtime_error {"A task can only depend on tasks that were added before it."};
+        }
+
+        nodes_[dependency].dependents.push_back(id);
+    }
+
+    nodes_.push_back(Node {std::move(name), std::move(work), dependencies.size(), {}});
+
+    return id;
+}
+
+auto TaskGraph::run(std::size_t n_threads) -> std::vector<TaskTiming>
+{
+    if (n_threads == 0) {
+        throw std::runtime_error {"The number of threads must be positive."};
+    }
+
+    const auto n_nodes = nodes_.size();
+
+    auto timings = std::vector<TaskTiming> {};
+    timings.reserve(n_nodes);
+    for (const auto& node : nodes_) {
+        timings.push_back({node.name, 0.0, 0.0, false});
+    }
+
+    if (n_nodes == 0) {
+        return timings;
+    }
+
+    // everything below is only ever touched while holding the mutex, except for the timing of each task,
+    // which is only written by the worker that runs it
+    auto mutex = std::mutex {};
+    auto ready_condition = std::condition_variable {};
+
+    auto n_remaining_dependencies = std::vector<std::size_t> {};
+    n_remaining_dependencies.reserve(n_nodes);
+
+    auto ready = std::deque<NodeId> {};
+    for (NodeId id {0}; id < n_nodes; ++id) {
+        n_remaining_dependencies.push_back(nodes_[id].n_dependencies);
+        if (nodes_[id].n_dependencies == 0) {
+            ready.push_back(id);
+        }
+    }
+
+    auto n_unfinished = n_nodes;
+    auto first_error = std::exception_ptr {};
+
+    const auto run_start = Clock::now();
+
+    // a skipped task still passes through the queue, so that it can mark its own dependents as skipped
+    const auto worker = [&]()
+    {
+        auto lock = std::unique_lock {mutex};
+
+        while (true) {
+            ready_condition.wait(lock, [&]() { return !ready.empty() || n_unfinished == 0; });
+            if (n_unfinished == 0) {
+                return;
+            }
+
+            const auto id = ready.front();
+            ready.pop_front();
+
+            const auto is_skipped = timings[id].is_skipped;
+            auto error = std::exception_ptr {};
+
+            lock.unlock();
+
+            if (!is_skipped) {
+                const auto start = Clock::now();
+
+                try {
+                    nodes_[id].work();
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+
+                timings[id].start_seconds = seconds_between(run_start, start);
+                timings[id].seconds = seconds_between(start, Clock::now());
+            }
+
+            lock.lock();
+
+            if (error && !first_error) {
+                first_error = error;
+            }
+
+            for (const auto dependent : nodes_[id].dependents) {
+                if (is_skipped || error) {
+                    timings[dependent].is_skipped = true;
+                }
+
+                --n_remaining_dependencies[dependent];
+                if (n_remaining_dependencies[dependent] == 0) {
+                    ready.push_back(dependent);
+                }
+            }
+
+            --n_unfinished;
+            ready_condition.notify_all();
+        }
+    };
+
+    // there is no point in starting more threads than there are tasks
+    const auto n_workers = std::min(n_threads, n_nodes);
+
+    auto threads = std::vector<std::thread> {};
+    threads.reserve(n_workers - 1);
+    for (std::size_t i_worker {1}; i_worker < n_workers; ++i_worker) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+
+    return timings;
+}
+
+auto TaskGraph::size() const noexcept -> std::size_t
+{
+    return nodes_.size();
+}
+
+}  // namespace elec::parallel
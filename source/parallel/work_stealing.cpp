@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "elecstruct/parallel/work_stealing.hpp"
+
+namespace
+{
+
+using Work = std::function<void()>;
+
+class TaskQueue
+{
+public:
+    void push_back(Work work)
+    {
+        const auto lock = std::scoped_lock {mutex_};
+        tasks_.push_back(std::move(work));
+    }
+
+    auto pop_front() -> std::optional<Work>
+    {
+        const auto lock = std::scoped_lock {mutex_};
+        if (tasks_.empty()) {
+            return std::nullopt;
+        }
+
+        auto work = std::move(tasks_.front());
+        tasks_.pop_front();
+
+        return work;
+    }
+
+    auto steal_back() -> std::optional<Work>
+    {
+        const auto lock = std::scoped_lock {mutex_};
+        if (tasks_.empty()) {
+            return std::nullopt;
+        }
+
+        auto work = std::move(tasks_.back());
+        tasks_.pop_back();
+
+        return work;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque<Work> tasks_;
+};
+
+/*
+    Longest-processing-time-first: hand out the most expensive tasks first, each to the queue with
+    the least total work so far.
+*/
+void distribute_tasks(std::vector<elec::parallel::WeightedTask> tasks, std::vector<TaskQueue>& queues)
+{
+    const auto is_more_expensive = [](const auto& left, const auto& right) { return left.cost > right.cost; };
+    std::stable_sort(tasks.begin(), tasks.end(), is_more_expensive);
+
+    auto loads = std::vector<double>(queues.size(), 0.0);
+
+    for (auto& task : tasks) {
+        const auto least_loaded = std::min_element(loads.begin(), loads.end());
+        const auto i_queue = static_cast<std::size_t>(std::distance(loads.begin(), least_loaded));
+
+        queues[i_queue].push_back(std::move(task.work));
+        *least_loaded += task.cost;
+    }
+}
+
+}  // anonymous namespace
+
+namespace elec::parallel
+{
+
+void run_work_stealing(std::vector<WeightedTask> tasks, std::size_t n_threads)
+{
+    if (n_threads == 0) {
+        throw std::runtime_error {"The number of threads must be positive."};
+    }
+
+    if (tasks.empty()) {
+        return;
+    }
+
+    // there is no point in starting threads that can never get any work
+    const auto n_workers = std::min(n_threads, tasks.size());
+
+    auto queues = std::vector<TaskQueue>(n_workers);
+    distribute_tasks(std::move(tasks), queues);
+
+    auto first_error = std::exception_ptr {};
+    auto error_mutex = std::mutex {};
+
+    // no new tasks are created while running, so a worker that finds every queue empty is done
+    const auto worker = [&](std::size_t i_worker)
+    {
+        while (true) {
+            auto work = queues[i_worker].pop_front();
+
+            for (std::size_t offset {1}; !work && offset < n_workers; ++offset) {
+                work = queues[(i_worker + offset) % n_workers].steal_back();
+            }
+
+            if (!work) {
+                return;
+            }
+
+            try {
+                (*work)();
+            }
+            catch (...) {
+                const auto lock = std::scoped_lock {error_mutex};
+                if (!first_error) {
+                    first_error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    auto threads = std::vector<std::thread> {};
+    threads.reserve(n_workers - 1);
+    for (std::size_t i_worker {1}; i_worker < n_workers; ++i_worker) {
+        threads.emplace_back(worker, i_worker);
+    }
+
+    worker(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+}  // namespace elec::parallel
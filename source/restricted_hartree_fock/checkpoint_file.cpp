@@ -0,0 +1,348 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+
+#include "elecstruct/restricted_hartree_fock/checkpoint_file.hpp"
+
+namespace
+{
+
+constexpr auto FILE_MAGIC_ = std::array<char, 8> {'E', 'L', 'E', 'C', 'C', 'H', 'K', '1'};
+constexpr auto FILE_VERSION_ = std::uint64_t {1};
+
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::uint64_t version;
+    std::uint64_t n_basis_functions;
+    std::uint64_t basis_hash;
+    std::uint64_t iteration;
+    std::uint64_t n_diis_entries;
+    std::uint64_t n_two_electron_integrals;
+    std::uint64_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 64, "The header must be tightly packed.");
+
+// the overlap, core Hamiltonian, and density matrices come before the DIIS matrices
+constexpr auto N_FIXED_MATRICES_ = std::size_t {3};
+
+/*
+    The 64-bit FNV-1a hash; it is not meant to stand up to anyone trying to cause a collision, only to
+    catch a checkpoint being used with the wrong molecule or basis.
+*/
+class Fnv1aHash
+{
+public:
+    template <typename T>
+    void add(const T& value) noexcept
+    {
+        auto bytes = std::array<unsigned char, sizeof(T)> {};
+        std::memcpy(bytes.data(), &value, sizeof(T));
+
+        for (const auto byte : bytes) {
+            hash_ ^= static_cast<std::uint64_t>(byte);
+            hash_ *= PRIME_;
+        }
+    }
+
+    auto value() const noexcept -> std::uint64_t
+    {
+        return hash_;
+    }
+
+private:
+    static constexpr auto OFFSET_BASIS_ = std::uint64_t {14695981039346656037ULL};
+    static constexpr auto PRIME_ = std::uint64_t {1099511628211ULL};
+
+    std::uint64_t hash_ {OFFSET_BASIS_};
+};
+
+auto to_checkpoint_basis_function(const elec::AtomicOrbitalInfoSTO3G& info) noexcept -> elec::CheckpointBasisFunction
+{
+    const auto& ang_mom = info.angular_momentum;
+    const auto& pos = info.position;
+
+    return {
+        static_cast<std::int64_t>(info.atom_label),
+        static_cast<std::int64_t>(info.orbital_label),
+        {ang_mom.x, ang_mom.y, ang_mom.z},
+        {pos.x, pos.y, pos.z}
+    };
+}
+
+void write_bytes(std::ofstream& stream, const void* data, std::size_t n_bytes)
+{
+    stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(n_bytes));
+    if (!stream) {
+        throw std::runtime_error {"Failed to write to the checkpoint file."};
+    }
+}
+
+void write_matrix(std::ofstream& stream, const Eigen::MatrixXd& matrix, Eigen::Index size)
+{
+    if (matrix.rows() != size || matrix.cols() != size) {
+        throw std::runtime_error {"A matrix in the checkpoint does not match the size of the basis."};
+    }
+
+    write_bytes(stream, matrix.data(), static_cast<std::size_t>(matrix.size()) * sizeof(double));
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto basis_hash(const std::vector<AtomicOrbitalInfoSTO3G>& basis) noexcept -> std::uint64_t
+{
+    auto hash = Fnv1aHash {};
+    hash.add(static_cast<std::uint64_t>(basis.size()));
+
+    for (const auto& info : basis) {
+        const auto function = to_checkpoint_basis_function(info);
+        hash.add(function.atom_label);
+        hash.add(function.orbital_label);
+        hash.add(function.angular_momentum);
+        hash.add(function.position);
+
+        for (const auto& gaussian : info.gaussians) {
+            hash.add(gaussian.contraction_coeff);
+            hash.add(gaussian.exponent_coeff);
+        }
+    }
+
+    return hash.value();
+}
+
+void write_checkpoint_file(
+    const std::filesystem::path& path,
+    const std::vector<AtomicOrbitalInfoSTO3G>& basis,
+    std::size_t iteration,
+    const Eigen::MatrixXd& overlap_mtx,
+    const Eigen::MatrixXd& core_hamiltonian_mtx,
+    const Eigen::MatrixXd& density_mtx,
+    const DiisExtrapolator* diis,
+    std::span<const double> two_electron_integrals
+)
+{
+    const auto size = static_cast<Eigen::Index>(basis.size());
+    const auto n_diis_entries = (diis != nullptr) ? diis->n_stored() : std::size_t {0};
+
+    const auto header = FileHeader {
+        FILE_MAGIC_,
+        FILE_VERSION_,
+        static_cast<std::uint64_t>(basis.size()),
+        basis_hash(basis),
+        static_cast<std::uint64_t>(iteration),
+        static_cast<std::uint64_t>(n_diis_entries),
+        static_cast<std::uint64_t>(two_electron_integrals.size()),
+        0
+    };
+
+    auto temporary_path = path;
+    temporary_path += ".tmp";
+
+    {
+        auto stream = std::ofstream {temporary_path, std::ios::binary | std::ios::trunc};
+        if (!stream) {
+            throw std::runtime_error {"Failed to open the checkpoint file '" + temporary_path.string() + "'."};
+        }
+
+        write_bytes(stream, &header, sizeof(FileHeader));
+
+        for (const auto& info : basis) {
+            const auto function = to_checkpoint_basis_function(info);
+            write_bytes(stream, &function, sizeof(CheckpointBasisFunction));
+        }
+
+        write_matrix(stream, overlap_mtx, size);
+        write_matrix(stream, core_hamiltonian_mtx, size);
+        write_matrix(stream, density_mtx, size);
+
+        if (diis != nullptr) {
+            for (std::size_t i_stored {0}; i_stored < diis->n_stored(); ++i_stored) {
+                write_matrix(stream, diis->fock_matrix(i_stored), size);
+            }
+            for (std::size_t i_stored {0}; i_stored < diis->n_stored(); ++i_stored) {
+                write_matrix(stream, diis->error_matrix(i_stored), size);
+            }
+        }
+
+        write_bytes(stream, two_electron_integrals.data(), two_electron_integrals.size_bytes());
+
+        stream.close();
+        if (stream.fail()) {
+            throw std::runtime_error {"Failed to finish writing the checkpoint file."};
+        }
+    }
+
+    // replacing the old checkpoint in a single step means that there is always a complete checkpoint
+    // on disk, no matter when the calculation gets killed
+    auto error = std::error_code {};
+    std::filesystem::rename(temporary_path, path, error);
+    if (error) {
+        std::filesystem::remove(temporary_path, error);
+        throw std::runtime_error {"Failed to replace the checkpoint file '" + path.string() + "'."};
+    }
+}
+
+// --- CheckpointFileReader
+
+CheckpointFileReader::CheckpointFileReader(const std::filesystem::path& path)
+{
+    const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
+        throw std::runtime_error {"Failed to open the checkpoint file '" + path.string() + "'."};
+    }
+
+    struct stat file_status;
+    if (::fstat(file_descriptor, &file_status) != 0 || file_status.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(file_descriptor);
+        throw std::runtime_error {"The checkpoint file '" + path.string() + "' is too small."};
+    }
+
+    mapping_size_ = static_cast<std::size_t>(file_status.st_size);
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+    // the mapping keeps its own reference to the file
+    ::close(file_descriptor);
+
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error {"Failed to map the checkpoint file '" + path.string() + "'."};
+    }
+
+    auto header = FileHeader {};
+    std::memcpy(&header, mapping_, sizeof(FileHeader));
+
+    const auto n_basis = static_cast<std::size_t>(header.n_basis_functions);
+    const auto n_matrices = N_FIXED_MATRICES_ + 2 * static_cast<std::size_t>(header.n_diis_entries);
+    const auto n_integrals = static_cast<std::size_t>(header.n_two_electron_integrals);
+
+    const auto basis_offset = sizeof(FileHeader);
+    const auto matrices_offset = basis_offset + n_basis * sizeof(CheckpointBasisFunction);
+    const auto integrals_offset = matrices_offset + n_matrices * n_basis * n_basis * sizeof(double);
+    const auto expected_size = integrals_offset + n_integrals * sizeof(double);
+
+    if (header.magic != FILE_MAGIC_ || header.version != FILE_VERSION_ || expected_size != mapping_size_) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        throw std::runtime_error {"The file '" + path.string() + "' is not a valid checkpoint file."};
+    }
+
+    n_basis_functions_ = n_basis;
+    basis_hash_ = header.basis_hash;
+    iteration_ = static_cast<std::size_t>(header.iteration);
+    n_diis_entries_ = static_cast<std::size_t>(header.n_diis_entries);
+
+    const auto* bytes = static_cast<const char*>(mapping_);
+
+    // NOLINTBEGIN
+    basis_functions_ = {reinterpret_cast<const CheckpointBasisFunction*>(bytes + basis_offset), n_basis};
+    matrices_ = reinterpret_cast<const double*>(bytes + matrices_offset);
+    two_electron_integrals_ = {reinterpret_cast<const double*>(bytes + integrals_offset), n_integrals};
+    // NOLINTEND
+}
+
+CheckpointFileReader::~CheckpointFileReader()
+{
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+    }
+}
+
+auto CheckpointFileReader::matches_basis(const std::vector<AtomicOrbitalInfoSTO3G>& basis) const noexcept -> bool
+{
+    return n_basis_functions_ == basis.size() && basis_hash_ == elec::basis_hash(basis);
+}
+
+auto CheckpointFileReader::n_basis_functions() const noexcept -> std::size_t
+{
+    return n_basis_functions_;
+}
+
+auto CheckpointFileReader::basis_hash() const noexcept -> std::uint64_t
+{
+    return basis_hash_;
+}
+
+auto CheckpointFileReader::iteration() const noexcept -> std::size_t
+{
+    return iteration_;
+}
+
+auto CheckpointFileReader::n_diis_entries() const noexcept -> std::size_t
+{
+    return n_diis_entries_;
+}
+
+auto CheckpointFileReader::basis_functions() const noexcept -> std::span<const CheckpointBasisFunction>
+{
+    return basis_functions_;
+}
+
+auto CheckpointFileReader::overlap_matrix() const noexcept -> MatrixView
+{
+    return matrix_(0);
+}
+
+auto CheckpointFileReader::core_hamiltonian_matrix() const noexcept -> MatrixView
+{
+    return matrix_(1);
+}
+
+auto CheckpointFileReader::density_matrix() const noexcept -> MatrixView
+{
+    return matrix_(2);
+}
+
+auto CheckpointFileReader::diis_fock_matrix(std::size_t i_entry) const -> MatrixView
+{
+    if (i_entry >= n_diis_entries_) {
+        throw std::runtime_error {"The checkpoint holds fewer DIIS entries than requested."};
+    }
+
+    return matrix_(N_FIXED_MATRICES_ + i_entry);
+}
+
+auto CheckpointFileReader::diis_error_matrix(std::size_t i_entry) const -> MatrixView
+{
+    if (i_entry >= n_diis_entries_) {
+        throw std::runtime_error {"The checkpoint holds fewer DIIS entries than requested."};
+    }
+
+    return matrix_(N_FIXED_MATRICES_ + n_diis_entries_ + i_entry);
+}
+
+auto CheckpointFileReader::two_electron_integrals() const noexcept -> std::span<const double>
+{
+    return two_electron_integrals_;
+}
+
+auto CheckpointFileReader::matrix_(std::size_t i_matrix) const noexcept -> MatrixView
+{
+    const auto size = static_cast<Eigen::Index>(n_basis_functions_);
+    const auto offset = i_matrix * n_basis_functions_ * n_basis_functions_;
+
+    return MatrixView {matrices_ + offset, size, size};  // NOLINT
+}
+
+}  // namespace elec
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+
+namespace elec
+{
+
+auto diis_error_matrix(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& density_mtx,
+    const Eigen::MatrixXd& overlap_mtx
+) -> Eigen::MatrixXd
+{
+    // for symmetric F, D, and S, the matrix SDF is the transpose of FDS
+    const auto fds = (fock_mtx * density_mtx * overlap_mtx).eval();
+
+    return fds - fds.transpose();
+}
+
+void diis_error_matrix(
+    Eigen::MatrixXd& error_mtx,
+    Eigen::MatrixXd& fock_density_mtx,
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& density_mtx,
+    const Eigen::MatrixXd& overlap_mtx
+)
+{
+    const auto size = fock_mtx.rows();
+    const auto is_size = [size](const Eigen::MatrixXd& mtx) { return mtx.rows() == size && mtx.cols() == size; };
+
+    if (!is_size(error_mtx) || !is_size(fock_density_mtx) || !is_size(fock_mtx) || !is_size(density_mtx)
+        || !is_size(overlap_mtx)) {
+        throw std::runtime_error {"The matrices of the DIIS error matrix do not all have the same size."};
+    }
+
+    fock_density_mtx.noalias() = fock_mtx * density_mtx;
+    error_mtx.noalias() = fock_density_mtx * overlap_mtx;
+
+    // the transpose cannot be subtracted from the matrix it is read from, so it passes through the
+    // buffer of FD, which is not needed anymore
+    fock_density_mtx = error_mtx.transpose();
+    error_mtx -= fock_density_mtx;
+}
+
+DiisExtrapolator::DiisExtrapolator(std::size_t history_length)
+    : history_length_ {history_length}
+{
+    if (history_length_ == 0) {
+        throw std::runtime_error {"The DIIS history must hold at least one Fock matrix."};
+    }
+
+    const auto history_length_eig = static_cast<Eigen::Index>(history_length_);
+    fock_matrices_.resize(history_length_);
+    error_matrices_.resize(history_length_);
+    error_overlaps_ = Eigen::MatrixXd::Zero(history_length_eig, history_length_eig);
+}
+
+void DiisExtrapolator::push(const Eigen::MatrixXd& fock_mtx, const Eigen::MatrixXd& error_mtx)
+{
+    if (fock_mtx.rows() != error_mtx.rows() || fock_mtx.cols() != error_mtx.cols()) {
+        throw std::runtime_error {"A DIIS Fock matrix and its error matrix must have the same size."};
+    }
+
+    // every slot is allocated on the first push; afterwards, the matrices are copied into the slots
+    // without allocating
+    if (fock_matrices_[0].size() == 0) {
+        for (std::size_t i_slot {0}; i_slot < history_length_; ++i_slot) {
+            fock_matrices_[i_slot].resize(fock_mtx.rows(), fock_mtx.cols());
+            error_matrices_[i_slot].resize(error_mtx.rows(), error_mtx.cols());
+        }
+    }
+    else if (fock_mtx.rows() != fock_matrices_[0].rows() || fock_mtx.cols() != fock_matrices_[0].cols()) {
+        throw std::runtime_error {"A DIIS Fock matrix must have the same size as the ones pushed before it."};
+    }
+
+    const auto i_slot = i_next_slot_;
+    fock_matrices_[i_slot] = fock_mtx;
+    error_matrices_[i_slot] = error_mtx;
+
+    i_next_slot_ = (i_next_slot_ + 1) % history_length_;
+    n_stored_ = std::min(n_stored_ + 1, history_length_);
+
+    // the slots of the other stored matrices are not necessarily the first `n_stored_` slots, but an
+    // overlap with a slot that is still empty is never read
+    const auto i_slot_eig = static_cast<Eigen::Index>(i_slot);
+    const auto& new_error_mtx = error_matrices_[i_slot];
+    for (std::size_t i_stored {0}; i_stored < n_stored_; ++i_stored) {
+        const auto i_other_slot = slot_(i_stored);
+        const auto i_other_slot_eig = static_cast<Eigen::Index>(i_other_slot);
+
+        const auto overlap = error_matrices_[i_other_slot].cwiseProduct(new_error_mtx).sum();
+        error_overlaps_(i_other_slot_eig, i_slot_eig) = overlap;
+        error_overlaps_(i_slot_eig, i_other_slot_eig) = overlap;
+    }
+}
+
+auto DiisExtrapolator::coefficients() const -> Eigen::VectorXd
+{
+    check_not_empty_();
+
+    const auto n_stored_eig = static_cast<Eigen::Index>(n_stored_);
+
+    // the Lagrangian of the constrained minimization gives the linear system
+    //
+    //     [ B  -1 ] [ c ]   [  0 ]
+    //     [ -1  0 ] [ l ] = [ -1 ]
+    //
+    // the error overlaps are rescaled so that the system is not needlessly badly conditioned as the
+    // errors shrink, and the system is solved with a rank-revealing decomposition, because the most
+    // recent error matrices become close to linearly dependent near convergence
+    auto scale = double {0.0};
+    for (std::size_t i_stored {0}; i_stored < n_stored_; ++i_stored) {
+        const auto i_slot_eig = static_cast<Eigen::Index>(slot_(i_stored));
+        scale = std::max(scale, error_overlaps_(i_slot_eig, i_slot_eig));
+    }
+    const auto inverse_scale = (scale > 0.0) ? 1.0 / scale : 1.0;
+
+    // the overlaps are stored by slot, but the system is set up from the oldest to the most recent
+    auto lhs = Eigen::MatrixXd {n_stored_eig + 1, n_stored_eig + 1};
+    for (std::size_t i0 {0}; i0 < n_stored_; ++i0) {
+        for (std::size_t i1 {0}; i1 < n_stored_; ++i1) {
+            const auto i0_slot_eig = static_cast<Eigen::Index>(slot_(i0));
+            const auto i1_slot_eig = static_cast<Eigen::Index>(slot_(i1));
+            lhs(static_cast<Eigen::Index>(i0), static_cast<Eigen::Index>(i1)) =
+                inverse_scale * error_overlaps_(i0_slot_eig, i1_slot_eig);
+        }
+    }
+    lhs.col(n_stored_eig).head(n_stored_eig).setConstant(-1.0);
+    lhs.row(n_stored_eig).head(n_stored_eig).setConstant(-1.0);
+    lhs(n_stored_eig, n_stored_eig) = 0.0;
+
+    auto rhs = Eigen::VectorXd::Zero(n_stored_eig + 1).eval();
+    rhs(n_stored_eig) = -1.0;
+
+    const auto solution = lhs.completeOrthogonalDecomposition().solve(rhs).eval();
+
+    return solution.head(n_stored_eig);
+}
+
+auto DiisExtrapolator::extrapolate() const -> Eigen::MatrixXd
+{
+    check_not_empty_();
+
+    const auto& newest_fock_mtx = fock_matrix(n_stored_ - 1);
+    auto output = Eigen::MatrixXd {newest_fock_mtx.rows(), newest_fock_mtx.cols()};
+    extrapolate(output);
+
+    return output;
+}
+
+void DiisExtrapolator::extrapolate(Eigen::MatrixXd& fock_mtx) const
+{
+    const auto coeffs = coefficients();
+
+    const auto& oldest_fock_mtx = fock_matrix(0);
+    if (fock_mtx.rows() != oldest_fock_mtx.rows() || fock_mtx.cols() != oldest_fock_mtx.cols()) {
+        throw std::runtime_error {"The extrapolated Fock matrix does not match the size of the stored ones."};
+    }
+
+    fock_mtx = coeffs(0) * oldest_fock_mtx;
+    for (std::size_t i_stored {1}; i_stored < n_stored_; ++i_stored) {
+        fock_mtx += coeffs(static_cast<Eigen::Index>(i_stored)) * fock_matrix(i_stored);
+    }
+}
+
+auto DiisExtrapolator::max_error() const -> double
+{
+    if (n_stored_ == 0) {
+        throw std::runtime_error {"No DIIS error matrices have been stored."};
+    }
+
+    return error_matrix(n_stored_ - 1).cwiseAbs().maxCoeff();
+}
+
+auto DiisExtrapolator::n_stored() const noexcept -> std::size_t
+{
+    return n_stored_;
+}
+
+auto DiisExtrapolator::fock_matrix(std::size_t i_stored) const -> const Eigen::MatrixXd&
+{
+    if (i_stored >= n_stored_) {
+        throw std::runtime_error {"The DIIS history does not hold that many Fock matrices."};
+    }
+
+    return fock_matrices_[slot_(i_stored)];
+}
+
+auto DiisExtrapolator::error_matrix(std::size_t i_stored) const -> const Eigen::MatrixXd&
+{
+    if (i_stored >= n_stored_) {
+        throw std::runtime_error {"The DIIS history does not hold that many error matrices."};
+    }
+
+    return error_matrices_[slot_(i_stored)];
+}
+
+auto DiisExtrapolator::history_length() const noexcept -> std::size_t
+{
+    return history_length_;
+}
+
+auto DiisExtrapolator::slot_(std::size_t i_stored) const noexcept -> std::size_t
+{
+    // the oldest stored pair sits just after the most recent one, once the ring is full
+    return (i_next_slot_ + history_length_ - n_stored_ + i_stored) % history_length_;
+}
+
+void DiisExtrapolator::check_not_empty_() const
+{
+    if (n_stored_ == 0) {
+        throw std::runtime_error {"Cannot perform a DIIS extrapolation without any stored Fock matrices."};
+    }
+}
+
+}  // namespace elec
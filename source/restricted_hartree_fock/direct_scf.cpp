@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+#include "elecstruct/matrices.hpp"
+
+#include "elecstruct/restricted_hartree_fock/direct_scf.hpp"
+
+namespace
+{
+
+/*
+    The largest density matrix element that the integral (i0 i1|i2 i3) gets multiplied by when its
+    contributions are added to the two-electron matrix; the exchange contributions carry a quarter of
+    the weight of the Coulomb contributions.
+*/
+auto max_density_weight(
+    const Eigen::MatrixXd& density_mtx,
+    Eigen::Index i0,
+    Eigen::Index i1,
+    Eigen::Index i2,
+    Eigen::Index i3
+) noexcept -> double
+{
+    const auto coulomb = std::max(std::fabs(density_mtx(i0, i1)), std::fabs(density_mtx(i2, i3)));
+    const auto exchange = std::max(
+        std::max(std::fabs(density_mtx(i0, i2)), std::fabs(density_mtx(i1, i3))),
+        std::max(std::fabs(density_mtx(i0, i3)), std::fabs(density_mtx(i1, i2)))
+    );
+
+    return std::max(coulomb, 0.25 * exchange);
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto electron_electron_matrix_direct(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    const Eigen::MatrixXd& density_mtx,
+    ElectronElectronEngine engine
+) -> std::tuple<Eigen::MatrixXd, std::size_t>
+{
+    const auto size_eig = static_cast<Eigen::Index>(shell_pairs.n_basis_functions());
+
+    auto output = Eigen::MatrixXd {size_eig, size_eig};
+    const auto n_skipped = electron_electron_matrix_direct(output, shell_pairs, screening, density_mtx, engine);
+
+    return {std::move(output), n_skipped};
+}
+
+auto electron_electron_matrix_direct(
+    Eigen::MatrixXd& electron_electron_mtx,
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    const Eigen::MatrixXd& density_mtx,
+    ElectronElectronEngine engine
+) -> std::size_t
+{
+    const auto size = shell_pairs.n_basis_functions();
+    const auto size_eig = static_cast<Eigen::Index>(size);
+
+    if (density_mtx.rows() != size_eig || density_mtx.cols() != size_eig) {
+        throw std::runtime_error {"The density matrix does not match the number of basis functions."};
+    }
+
+    if (electron_electron_mtx.rows() != size_eig || electron_electron_mtx.cols() != size_eig) {
+        throw std::runtime_error {"The electron-electron matrix does not match the number of basis functions."};
+    }
+
+    electron_electron_mtx.setZero();
+    auto n_skipped = std::size_t {0};
+
+    for (const auto [i0, i1, i2, i3] : UniqueQuartetGenerator {size}) {
+        const auto i0_eig = static_cast<Eigen::Index>(i0);
+        const auto i1_eig = static_cast<Eigen::Index>(i1);
+        const auto i2_eig = static_cast<Eigen::Index>(i2);
+        const auto i3_eig = static_cast<Eigen::Index>(i3);
+
+        const auto weight = max_density_weight(density_mtx, i0_eig, i1_eig, i2_eig, i3_eig);
+        if (screening.bound(i0, i1, i2, i3) * weight < screening.tolerance()) {
+            ++n_skipped;
+            continue;
+        }
+
+        const auto integral = electron_electron_integral(shell_pairs.get(i0, i1), shell_pairs.get(i2, i3), engine);
+        add_unique_integral_contributions(electron_electron_mtx, density_mtx, i0, i1, i2, i3, integral);
+    }
+
+    // 0.5 * (G + G^T), one pair of transposed elements at a time, since the matrix cannot be assigned an
+    // expression that reads its own transpose
+    for (Eigen::Index i0 {0}; i0 < size_eig; ++i0) {
+        for (Eigen::Index i1 {i0 + 1}; i1 < size_eig; ++i1) {
+            const auto symmetrized = 0.5 * (electron_electron_mtx(i0, i1) + electron_electron_mtx(i1, i0));
+            electron_electron_mtx(i0, i1) = symmetrized;
+            electron_electron_mtx(i1, i0) = symmetrized;
+        }
+    }
+
+    return n_skipped;
+}
+
+IncrementalElectronElectronMatrix::IncrementalElectronElectronMatrix(
+    const ShellPairData& shell_pairs,
+    const SchwarzScreening& screening,
+    ElectronElectronEngine engine,
+    std::size_t full_rebuild_period
+)
+    : shell_pairs_ {shell_pairs}
+    , screening_ {screening}
+    , engine_ {engine}
+    , full_rebuild_period_ {full_rebuild_period}
+{
+    if (full_rebuild_period_ == 0) {
+        throw std::runtime_error {"The period between full rebuilds of the two-electron matrix must be positive."};
+    }
+
+    const auto size = static_cast<Eigen::Index>(shell_pairs_.n_basis_functions());
+    density_mtx_ = Eigen::MatrixXd::Zero(size, size);
+    electron_electron_mtx_ = Eigen::MatrixXd::Zero(size, size);
+    density_change_mtx_ = Eigen::MatrixXd::Zero(size, size);
+    electron_electron_change_mtx_ = Eigen::MatrixXd::Zero(size, size);
+}
+
+auto IncrementalElectronElectronMatrix::update(const Eigen::MatrixXd& density_mtx) -> const Eigen::MatrixXd&
+{
+    was_full_rebuild_ = (n_updates_ % full_rebuild_period_ == 0);
+
+    // every matrix below already has the size of the basis, so none of the assignments allocate
+    if (was_full_rebuild_) {
+        n_skipped_ =
+            electron_electron_matrix_direct(electron_electron_mtx_, shell_pairs_, screening_, density_mtx, engine_);
+    }
+    else {
+        density_change_mtx_ = density_mtx - density_mtx_;
+        n_skipped_ = electron_electron_matrix_direct(
+            electron_electron_change_mtx_, shell_pairs_, screening_, density_change_mtx_, engine_
+        );
+
+        electron_electron_mtx_ += electron_electron_change_mtx_;
+    }
+
+    density_mtx_ = density_mtx;
+    ++n_updates_;
+
+    return electron_electron_mtx_;
+}
+
+auto IncrementalElectronElectronMatrix::n_skipped() const noexcept -> std::size_t
+{
+    return n_skipped_;
+}
+
+auto IncrementalElectronElectronMatrix::was_full_rebuild() const noexcept -> bool
+{
+    return was_full_rebuild_;
+}
+
+}  // namespace elec
@@ -1,5 +1,22 @@
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include <Eigen/Dense>
 
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+#include "elecstruct/restricted_hartree_fock/step.hpp"
+
 #include "elecstruct/restricted_hartree_fock/initial_density_matrix.hpp"
 
 /*
@@ -24,6 +41,119 @@ namespace
 */
 constexpr auto DEFAULT_EXTENDED_HUCKEL_CONSTANT = double {1.75};
 
+constexpr auto ATOMIC_SCF_MAX_ITERATIONS = std::size_t {100};
+constexpr auto ATOMIC_SCF_TOLERANCE_CHANGE_DENSITY_MATRIX = double {1.0e-10};
+
+// orbitals whose energies are closer than this are treated as members of the same shell
+constexpr auto DEGENERATE_ORBITAL_ENERGY_TOLERANCE = double {1.0e-8};
+
+/*
+    The density matrix that puts `n_electrons` electrons into the orbitals of the Fock matrix, in
+    order of increasing energy. The occupations are then averaged over each set of degenerate
+    orbitals, so that a partially filled shell is filled evenly, and the density stays spherical.
+*/
+auto spherically_averaged_density_matrix(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& transformation_mtx,
+    double n_electrons
+) -> Eigen::MatrixXd
+{
+    const auto fock_mtx_trans = (transformation_mtx.transpose() * fock_mtx * transformation_mtx).eval();
+
+    // the eigenvalues of a self-adjoint matrix are already sorted in increasing order
+    const auto eigensolver = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> {fock_mtx_trans};
+    if (eigensolver.info() != Eigen::Success) {
+        throw std::runtime_error {"Failed to perform eigenvalue decomposition of the atomic Fock matrix."};
+    }
+
+    const auto& energies = eigensolver.eigenvalues();
+    const auto coefficient_mtx = (transformation_mtx * eigensolver.eigenvectors()).eval();
+    const auto size = energies.size();
+
+    auto occupations = Eigen::VectorXd::Zero(size).eval();
+    auto n_remaining = n_electrons;
+    for (Eigen::Index i {0}; i < size && n_remaining > 0.0; ++i) {
+        occupations(i) = std::min(2.0, n_remaining);
+        n_remaining -= occupations(i);
+    }
+
+    if (n_remaining > 0.0) {
+        throw std::runtime_error {"The atomic orbitals cannot hold all the electrons of the atom."};
+    }
+
+    for (Eigen::Index i_begin {0}; i_begin < size;) {
+        auto i_end = i_begin + 1;
+        while (i_end < size && energies(i_end) - energies(i_begin) < DEGENERATE_ORBITAL_ENERGY_TOLERANCE) {
+            ++i_end;
+        }
+
+        const auto n_shell = i_end - i_begin;
+        occupations.segment(i_begin, n_shell).setConstant(occupations.segment(i_begin, n_shell).mean());
+        i_begin = i_end;
+    }
+
+    return coefficient_mtx * occupations.asDiagonal() * coefficient_mtx.transpose();
+}
+
+/*
+    A Hartree-Fock calculation of a single neutral atom, with fractional occupations for a partially
+    filled shell; the iterations are accelerated with DIIS.
+*/
+auto spherically_averaged_atomic_scf(elec::AtomLabel label, const std::vector<elec::AtomicOrbitalLabel>& orbitals)
+    -> Eigen::MatrixXd
+{
+    const auto atoms = std::vector<elec::AtomInfo> {
+        elec::AtomInfo {label, coord::Cartesian3D {0.0, 0.0, 0.0}, orbitals}
+    };
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+
+    const auto [overlap_mtx, kinetic_mtx, nuclear_mtx] = elec::one_electron_matrices(shell_pairs, atoms);
+    const auto transformation_mtx = elec::transformation_matrix(overlap_mtx);
+    const auto core_hamiltonian_mtx = (kinetic_mtx + nuclear_mtx).eval();
+    const auto two_electron_integrals = elec::two_electron_integral_grid(shell_pairs);
+
+    const auto n_electrons = elec::nuclear_charge(label);
+
+    auto diis = elec::DiisExtrapolator {};
+    auto density_mtx = spherically_averaged_density_matrix(core_hamiltonian_mtx, transformation_mtx, n_electrons);
+
+    for (std::size_t i_iter {0}; i_iter < ATOMIC_SCF_MAX_ITERATIONS; ++i_iter) {
+        const auto fock_mtx = elec::fock_matrix(density_mtx, basis, two_electron_integrals, core_hamiltonian_mtx);
+        diis.push(fock_mtx, elec::diis_error_matrix(fock_mtx, density_mtx, overlap_mtx));
+
+        auto new_density_mtx = spherically_averaged_density_matrix(diis.extrapolate(), transformation_mtx, n_electrons);
+        const auto difference = elec::density_matrix_difference(density_mtx, new_density_mtx);
+        density_mtx = std::move(new_density_mtx);
+
+        if (difference < ATOMIC_SCF_TOLERANCE_CHANGE_DENSITY_MATRIX) {
+            return density_mtx;
+        }
+    }
+
+    // the result is only a starting guess for the molecular calculation, so an atom that has not fully
+    // converged is still good enough to use
+    return density_mtx;
+}
+
+using AtomicDensityKey = std::pair<elec::AtomLabel, std::vector<elec::AtomicOrbitalLabel>>;
+
+/*
+    The atomic density matrices calculated so far in this process. The elements of a std::map never
+    move, so references to them stay valid as more atoms are added.
+*/
+auto atomic_density_cache() -> std::map<AtomicDensityKey, Eigen::MatrixXd>&
+{
+    static auto cache = std::map<AtomicDensityKey, Eigen::MatrixXd> {};
+    return cache;
+}
+
+auto atomic_density_cache_mutex() -> std::mutex&
+{
+    static auto mutex = std::mutex {};
+    return mutex;
+}
+
 }  // anonymous namespace
 
 namespace elec
@@ -57,4 +187,52 @@ auto core_hamiltonian_guess(const Eigen::MatrixXd& core_hamiltonian_mtx) -> Eige
     return core_hamiltonian_mtx;
 }
 
+auto atomic_density_matrix(AtomLabel label, const std::vector<AtomicOrbitalLabel>& orbitals) -> const Eigen::MatrixXd&
+{
+    auto key = AtomicDensityKey {label, orbitals};
+
+    // the atomic calculations are cheap enough that it is simpler to hold the lock while one runs
+    const auto lock = std::lock_guard<std::mutex> {atomic_density_cache_mutex()};
+
+    auto& cache = atomic_density_cache();
+    const auto it = cache.find(key);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    auto density_mtx = spherically_averaged_atomic_scf(label, orbitals);
+    return cache.emplace(std::move(key), std::move(density_mtx)).first->second;
+}
+
+auto superposition_of_atomic_densities(const std::vector<AtomInfo>& atoms, std::size_t n_electrons)
+    -> Eigen::MatrixXd
+{
+    auto size = Eigen::Index {0};
+    for (const auto& atom : atoms) {
+        for (const auto orbital : atom.orbitals) {
+            size += static_cast<Eigen::Index>(atomic_orbitals_to_angular_momentum_numbers(orbital).size());
+        }
+    }
+
+    auto output = Eigen::MatrixXd::Zero(size, size).eval();
+    auto n_neutral_electrons = double {0.0};
+
+    // the basis functions of each atom are contiguous, in the same order as in the atomic calculation
+    auto offset = Eigen::Index {0};
+    for (const auto& atom : atoms) {
+        const auto& atom_density_mtx = atomic_density_matrix(atom.label, atom.orbitals);
+        const auto n_atom = atom_density_mtx.rows();
+
+        output.block(offset, offset, n_atom, n_atom) = atom_density_mtx;
+        n_neutral_electrons += nuclear_charge(atom.label);
+        offset += n_atom;
+    }
+
+    if (n_neutral_electrons > 0.0) {
+        output *= static_cast<double>(n_electrons) / n_neutral_electrons;
+    }
+
+    return output;
+}
+
 }  // namespace elec
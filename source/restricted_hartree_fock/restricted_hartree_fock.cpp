@@ -1,14 +1,40 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <filesystem>
 #include <iomanip>
 #include <iostream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <system_error>
+#include <utility>
 #include <vector>
 
+#include <unistd.h>
+
 #include "elecstruct/atoms.hpp"
+#include "elecstruct/basis/auxiliary_basis.hpp"
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/input_file_parser/input_file_options.hpp"
 #include "elecstruct/input_file_parser/input_file_parser.hpp"
+#include "elecstruct/integrals/cholesky_decomposition.hpp"
+#include "elecstruct/integrals/density_fitting.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/two_electron_integral_file.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
 #include "elecstruct/matrices.hpp"
+#include "elecstruct/parallel/task_graph.hpp"
+#include "elecstruct/restricted_hartree_fock/checkpoint_file.hpp"
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+#include "elecstruct/restricted_hartree_fock/direct_scf.hpp"
 #include "elecstruct/restricted_hartree_fock/initial_density_matrix.hpp"
 #include "elecstruct/restricted_hartree_fock/step.hpp"
 
@@ -17,22 +43,28 @@
 namespace
 {
 
-void maybe_print(elec::Verbose is_verbose, const Eigen::MatrixXd& matrix, std::string_view name)
+void maybe_print(
+    std::ostream& output,
+    elec::Verbose is_verbose,
+    const Eigen::MatrixXd& matrix,
+    std::string_view name
+)
 {
     if (is_verbose == elec::Verbose::TRUE) {
-        std::cout << name << '\n';
-        std::cout << matrix << "\n\n";
+        output << name << '\n';
+        output << matrix << "\n\n";
     }
 }
 
-void maybe_print(elec::Verbose is_verbose, std::string_view text)
+void maybe_print(std::ostream& output, elec::Verbose is_verbose, std::string_view text)
 {
     if (is_verbose == elec::Verbose::TRUE) {
-        std::cout << text << "\n\n";
+        output << text << "\n\n";
     }
 }
 
 [[maybe_unused]] void maybe_print(
+    std::ostream& output,
     elec::Verbose is_verbose,
     const elec::TwoElectronIntegralGrid& grid,
     std::size_t n_basis_functions,
@@ -40,22 +72,22 @@ void maybe_print(elec::Verbose is_verbose, std::string_view text)
 )
 {
     if (is_verbose == elec::Verbose::TRUE) {
-        std::cout << name << '\n';
+        output << name << '\n';
 
         for (std::size_t i0 {0}; i0 < n_basis_functions; ++i0)
             for (std::size_t i1 {0}; i1 < n_basis_functions; ++i1)
                 for (std::size_t i2 {0}; i2 < n_basis_functions; ++i2)
                     for (std::size_t i3 {0}; i3 < n_basis_functions; ++i3) {
-                        std::cout << "(" << i0 << ", " << i1 << ", " << i2 << ", " << i3 << ") = ";
-                        std::cout << grid.get(i0, i1, i2, i3) << '\n';
+                        output << "(" << i0 << ", " << i1 << ", " << i2 << ", " << i3 << ") = ";
+                        output << grid.get(i0, i1, i2, i3) << '\n';
                     }
     }
 }
 
-void maybe_print_divider(elec::Verbose is_verbose)
+void maybe_print_divider(std::ostream& output, elec::Verbose is_verbose)
 {
     if (is_verbose == elec::Verbose::TRUE) {
-        std::cout
+        output
             << "----------------------------------------------------------------------------------------------------\n";
     }
 }
@@ -79,124 +111,532 @@ auto inital_fock_guess_matrix(
         case IFG::EXTENDED_HUCKEL_MATRIX : {
             return elec::extended_huckel_guess(overlap_mtx, core_hamiltonian_mtx);
         }
+        case IFG::SUPERPOSITION_OF_ATOMIC_DENSITIES : {
+            throw std::runtime_error {"The superposition of atomic densities is not a guess for the Fock matrix."};
+        }
         default : {
             throw std::runtime_error {"UNREACHABLE: unknown InitialFockGuess passed to function!"};
         }
     }
 }
 
-}  // anonymous namespace
+/*
+    Removes the two-electron integral file of an out-of-core calculation once the calculation ends,
+    no matter how it ends.
+*/
+class TemporaryFile
+{
+public:
+    explicit TemporaryFile(std::filesystem::path path)
+        : path_ {std::move(path)}
+    {}
+
+    ~TemporaryFile()
+    {
+        auto ignored = std::error_code {};
+        std::filesystem::remove(path_, ignored);
+    }
 
-namespace elec
+    TemporaryFile(const TemporaryFile&) = delete;
+    auto operator=(const TemporaryFile&) -> TemporaryFile& = delete;
+
+    auto path() const noexcept -> const std::filesystem::path&
+    {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+/*
+    The DIIS error is printed in scientific notation, without changing the format that the energies and
+    density matrix differences are printed in.
+*/
+void print_diis_error(std::ostream& output, double error)
 {
+    const auto flags = output.flags();
+    const auto precision = output.precision();
+
+    output << "DIIS error = " << std::scientific << std::setprecision(6) << error << '\n';
+
+    output.flags(flags);
+    output.precision(precision);
+}
 
 /*
-    NOTE: what information should I return from the method besides the energy?
+    How long each step of the setup took; the steps can run at the same time, so the start of each step
+    is printed as well.
 */
-void perform_restricted_hartree_fock(
+void print_setup_timings(std::ostream& output, const std::vector<elec::parallel::TaskTiming>& timings)
+{
+    const auto flags = output.flags();
+    const auto precision = output.precision();
+
+    output << std::fixed << std::setprecision(3);
+    for (const auto& timing : timings) {
+        output << "Setup step '" << timing.name << "' started at " << timing.start_seconds << " s and took "
+               << timing.seconds << " s\n";
+    }
+
+    output.flags(flags);
+    output.precision(precision);
+}
+
+/*
+    Several calculations can run at the same time in one process (for example, in a batch), so the
+    file name holds a counter as well as the process ID.
+*/
+auto two_electron_integral_file_path() -> std::filesystem::path
+{
+    static auto n_files_created = std::atomic<std::size_t> {0};
+    const auto i_file = n_files_created.fetch_add(1);
+
+    const auto filename = "elecstruct_two_electron_integrals_" + std::to_string(::getpid()) + "_"
+                        + std::to_string(i_file) + ".bin";
+    return std::filesystem::temp_directory_path() / filename;
+}
+
+using Clock = std::chrono::steady_clock;
+
+auto seconds_since(Clock::time_point start) -> double
+{
+    return std::chrono::duration<double> {Clock::now() - start}.count();
+}
+
+/*
+    The density matrix to start from, if the options ask for a warm start from an earlier calculation.
+*/
+auto warm_start_density_matrix(const elec::RestrictedHartreeFockOptions& options, std::size_t n_basis_functions)
+    -> std::optional<Eigen::MatrixXd>
+{
+    if (options.initial_density_mtx && options.initial_coefficient_mtx) {
+        throw std::runtime_error {"Only one of the initial density matrix and coefficient matrix can be given."};
+    }
+
+    const auto size = static_cast<Eigen::Index>(n_basis_functions);
+    const auto has_basis_size = [&](const Eigen::MatrixXd& matrix)
+    { return matrix.rows() == size && matrix.cols() == size; };
+
+    if (options.initial_density_mtx) {
+        if (!has_basis_size(*options.initial_density_mtx)) {
+            throw std::runtime_error {"The initial density matrix does not match the size of the basis."};
+        }
+
+        return *options.initial_density_mtx;
+    }
+
+    if (options.initial_coefficient_mtx) {
+        if (!has_basis_size(*options.initial_coefficient_mtx)) {
+            throw std::runtime_error {"The initial coefficient matrix does not match the size of the basis."};
+        }
+
+        return elec::density_matrix_restricted_hartree_fock(*options.initial_coefficient_mtx, options.n_electrons);
+    }
+
+    return std::nullopt;
+}
+
+}  // anonymous namespace
+
+namespace elec
+{
+
+auto perform_restricted_hartree_fock(
     const std::vector<AtomInfo>& atoms,
     const std::vector<AtomicOrbitalInfoSTO3G>& basis,
-    InitialFockGuess initial_fock,
-    std::size_t n_electrons,
-    std::size_t n_max_iter,
-    double tolerance_change_density_matrix,
-    Verbose is_verbose
-)
+    const RestrictedHartreeFockOptions& options
+) -> RestrictedHartreeFockResult
 {
-    // ------------------------------------------------------------------------
-    maybe_print(is_verbose, "Calculating 'overlap_mtx'");
-    const auto overlap_mtx = overlap_matrix(basis);
-    maybe_print(is_verbose, overlap_mtx, "overlap_mtx");
-    maybe_print_divider(is_verbose);
+    const auto start_time = Clock::now();
 
-    // ------------------------------------------------------------------------
-    maybe_print(is_verbose, "Calculating 'kinetic_mtx'");
-    auto kinetic_mtx = kinetic_matrix(basis);
-    maybe_print(is_verbose, kinetic_mtx, "kinetic_mtx");
-    maybe_print_divider(is_verbose);
+    const auto initial_fock = options.initial_fock;
+    const auto n_electrons = options.n_electrons;
+    const auto n_max_iter = options.n_max_iter;
+    const auto tolerance_change_density_matrix = options.tolerance_change_density_matrix;
+    const auto is_verbose = options.is_verbose;
 
-    // ------------------------------------------------------------------------
-    maybe_print(is_verbose, "Calculating 'nuclear_electron_mtx'");
-    auto nuclear_mtx = Eigen::MatrixXd::Zero(kinetic_mtx.cols(), kinetic_mtx.cols()).eval();
+    // a stream without a buffer discards everything written to it
+    auto discarded_output = std::ostream {nullptr};
+    auto& output = (options.output != nullptr) ? *options.output : discarded_output;
+
+    if (options.checkpoint_path && options.checkpoint_period == 0) {
+        throw std::runtime_error {"The checkpoint period must be at least one iteration."};
+    }
 
-    for (const auto& atom : atoms) {
-        if (is_verbose == Verbose::TRUE) {
-            const auto atom_name = elec::atom_name_from_label(atom.label);
-            std::cout << "Calculating 'nuclear_electron_mtx' term for atom '" << atom_name << "'\n";
+    auto checkpoint = std::optional<CheckpointFileReader> {};
+    if (options.restart_from_checkpoint) {
+        if (!options.checkpoint_path) {
+            throw std::runtime_error {"A restart needs a checkpoint file to restart from."};
         }
-        const auto atom_nuclear_electron_mtx = nuclear_electron_matrix(basis, atom);
-        maybe_print(is_verbose, atom_nuclear_electron_mtx, "atom_nuclear_electron_mtx");
 
-        nuclear_mtx += atom_nuclear_electron_mtx;
-    }
+        checkpoint.emplace(*options.checkpoint_path);
+        if (!checkpoint->matches_basis(basis)) {
+            throw std::runtime_error {"The checkpoint file was written for a different molecule or basis."};
+        }
 
-    maybe_print(is_verbose, nuclear_mtx, "nuclear_mtx");
-    maybe_print_divider(is_verbose);
+        output << "Restarting from the checkpoint of iteration " << checkpoint->iteration() << " in '"
+               << options.checkpoint_path->string() << "'\n";
+    }
 
     // ------------------------------------------------------------------------
-    maybe_print(is_verbose, "Calculating 'core_hamiltonian_mtx'");
-    const auto core_hamiltonian_mtx = kinetic_mtx + nuclear_mtx;
-    maybe_print(is_verbose, core_hamiltonian_mtx, "core_hamiltonian_mtx");
-    maybe_print_divider(is_verbose);
+    maybe_print(output, is_verbose, "Calculating 'shell_pairs'");
+    const auto shell_pairs = ShellPairData {basis};
+    maybe_print_divider(output, is_verbose);
 
     // ------------------------------------------------------------------------
-    maybe_print(is_verbose, "Calculating 'transformation_mtx'");
-    const auto transformation_mtx = transformation_matrix(overlap_mtx);
-    maybe_print(is_verbose, transformation_mtx, "transformation_mtx");
-    maybe_print_divider(is_verbose);
+    // the rest of the setup is a small graph of steps; the one-electron matrices and the orthogonalizer
+    // do not depend on the two-electron integrals, so they are calculated while the two-electron
+    // integrals are being calculated
+    const auto scf_mode = options.scf_mode;
+
+    auto overlap_mtx = Eigen::MatrixXd {};
+    auto kinetic_mtx = Eigen::MatrixXd {};
+    auto nuclear_mtx = Eigen::MatrixXd {};
+    auto core_hamiltonian_mtx = Eigen::MatrixXd {};
+    auto transformation_mtx = Eigen::MatrixXd {};
+    auto screening = std::optional<SchwarzScreening> {};
+
+    auto two_electron_integrals = TwoElectronIntegralGrid {};
+    auto two_electron_integral_file = std::optional<TemporaryFile> {};
+    auto factorized_integrals = std::optional<FactorizedTwoElectronIntegrals> {};
+
+    // the steps run at the same time, so the two-electron step writes its report here, and the report
+    // is written to the output once the whole graph has finished
+    auto two_electron_report = std::ostringstream {};
+
+    // the graph runs on two threads, one for the one-electron steps and one for the two-electron steps;
+    // only the conventional two-electron integrals are calculated across multiple threads, so the rest
+    // of the threads go to whichever of the two can use them
+    const auto n_threads = std::max(options.n_threads, std::size_t {1});
+    const auto n_setup_threads = std::min(n_threads, std::size_t {2});
+    const auto n_spare_threads = std::max(n_threads - 1, std::size_t {1});
+    const auto is_two_electron_step_threaded = (scf_mode == ScfMode::CONVENTIONAL);
+    const auto n_two_electron_threads = is_two_electron_step_threaded ? n_spare_threads : std::size_t {1};
+    const auto n_one_electron_threads = is_two_electron_step_threaded ? std::size_t {1} : n_spare_threads;
+
+    auto setup = parallel::TaskGraph {};
+
+    // the three one-electron matrices are calculated together, in a single pass over the primitive pairs
+    const auto one_electron_step = setup.add("one_electron_matrices", [&]() {
+        auto matrices = one_electron_matrices(shell_pairs, atoms, n_one_electron_threads);
+        overlap_mtx = std::move(matrices.overlap_mtx);
+        kinetic_mtx = std::move(matrices.kinetic_mtx);
+        nuclear_mtx = std::move(matrices.nuclear_electron_mtx);
+    });
+
+    const auto calculate_core_hamiltonian = [&]() { core_hamiltonian_mtx = kinetic_mtx + nuclear_mtx; };
+    setup.add("core_hamiltonian_mtx", calculate_core_hamiltonian, {one_electron_step});
+
+    const auto calculate_transformation = [&]() { transformation_mtx = transformation_matrix(overlap_mtx); };
+    setup.add("transformation_mtx", calculate_transformation, {one_electron_step});
+
+    const auto screening_step = setup.add("schwarz_screening", [&]() {
+        screening.emplace(shell_pairs, options.schwarz_screening_tolerance);
+    });
+
+    // a conventional calculation stores every integral up front, an out-of-core calculation writes
+    // them to disk up front, and the density fitting and Cholesky calculations store the factors of the
+    // integrals up front; a direct calculation recalculates them every time the Fock matrix is built,
+    // so nothing needs to be done here
+    const auto calculate_two_electron_integrals = [&]()
+    {
+        switch (scf_mode) {
+            case ScfMode::CONVENTIONAL : {
+                // the integrals in a checkpoint are copied straight out of the mapped file, instead of
+                // being calculated again; a checkpoint from a calculation that did not store them has none
+                const auto stored = checkpoint ? checkpoint->two_electron_integrals() : std::span<const double> {};
+                if (!stored.empty()) {
+                    two_electron_integrals = TwoElectronIntegralGrid {basis.size()};
+                    if (stored.size() != two_electron_integrals.size()) {
+                        throw std::runtime_error {"The checkpoint holds the wrong number of two-electron integrals."};
+                    }
 
-    // ------------------------------------------------------------------------
-    maybe_print(is_verbose, "Calculating 'two_electron_integrals'");
-    const auto two_electron_integrals = two_electron_integral_grid(basis);
-    // maybe_print(is_verbose, two_electron_integrals, basis.size(), "two_electron_integrals");
-    maybe_print_divider(is_verbose);
+                    std::copy(stored.begin(), stored.end(), two_electron_integrals.values().begin());
+
+                    two_electron_report << "Restored " << stored.size()
+                                        << " unique two-electron integrals from the checkpoint\n";
+                    break;
+                }
+
+                auto [integrals, n_skipped] = screened_two_electron_integral_grid(
+                    shell_pairs, *screening, n_two_electron_threads, options.electron_electron_engine
+                );
+                two_electron_integrals = std::move(integrals);
+
+                two_electron_report << "Skipped " << n_skipped << " of " << n_unique_quartets(basis.size())
+                                    << " unique two-electron integrals with Schwarz screening\n";
+                break;
+            }
+            case ScfMode::DIRECT : {
+                two_electron_report
+                    << "Performing a direct SCF calculation; the two-electron integrals are not stored\n";
+                break;
+            }
+            case ScfMode::OUT_OF_CORE : {
+                two_electron_integral_file.emplace(two_electron_integral_file_path());
+                const auto& path = two_electron_integral_file->path();
+
+                const auto n_skipped =
+                    write_two_electron_integral_file(path, shell_pairs, *screening, options.electron_electron_engine);
+
+                two_electron_report << "Skipped " << n_skipped << " of " << n_unique_quartets(basis.size())
+                                    << " unique two-electron integrals with Schwarz screening\n";
+                two_electron_report << "Wrote the two-electron integrals to '" << path.string() << "'\n";
+                break;
+            }
+            case ScfMode::DENSITY_FITTING : {
+                const auto aux_basis = create_even_tempered_auxiliary_basis(basis);
+                factorized_integrals =
+                    density_fitted_integrals(shell_pairs, aux_basis, options.electron_electron_engine);
+
+                two_electron_report << "Fitted the two-electron integrals with " << aux_basis.size()
+                                    << " auxiliary functions\n";
+                break;
+            }
+            case ScfMode::CHOLESKY : {
+                factorized_integrals = cholesky_decomposed_integrals(
+                    shell_pairs, options.cholesky_threshold, options.electron_electron_engine
+                );
+
+                two_electron_report << "Decomposed the two-electron integrals into "
+                                    << factorized_integrals->n_vectors() << " Cholesky vectors, for "
+                                    << basis.size() * (basis.size() + 1) / 2 << " index pairs\n";
+                break;
+            }
+            default : {
+                throw std::runtime_error {"UNREACHABLE: unknown ScfMode passed to function!"};
+            }
+        }
+    };
+
+    setup.add("two_electron_integrals", calculate_two_electron_integrals, {screening_step});
+
+    maybe_print(output, is_verbose, "Running the setup steps");
+    const auto setup_timings = setup.run(n_setup_threads);
+
+    print_setup_timings(output, setup_timings);
+    output << two_electron_report.str();
+    maybe_print_divider(output, is_verbose);
+
+    maybe_print(output, is_verbose, overlap_mtx, "overlap_mtx");
+    maybe_print(output, is_verbose, kinetic_mtx, "kinetic_mtx");
+    maybe_print(output, is_verbose, nuclear_mtx, "nuclear_mtx");
+    maybe_print(output, is_verbose, core_hamiltonian_mtx, "core_hamiltonian_mtx");
+    maybe_print(output, is_verbose, transformation_mtx, "transformation_mtx");
+    maybe_print_divider(output, is_verbose);
+
+    // only a direct calculation keeps track of the two-electron matrix between iterations
+    auto incremental_electron_electron_mtx = std::optional<IncrementalElectronElectronMatrix> {};
+    if (scf_mode == ScfMode::DIRECT) {
+        incremental_electron_electron_mtx.emplace(
+            shell_pairs, *screening, options.electron_electron_engine, options.direct_scf_full_rebuild_period
+        );
+    }
 
-    maybe_print_divider(is_verbose);
-    maybe_print_divider(is_verbose);
+    // with a history length of zero, DIIS is turned off
+    auto diis = std::optional<DiisExtrapolator> {};
+    if (options.diis_history_length > 0) {
+        diis.emplace(options.diis_history_length);
+    }
+
+    maybe_print_divider(output, is_verbose);
+
+    maybe_print_divider(output, is_verbose);
+    maybe_print_divider(output, is_verbose);
 
     // --- ITERATION 0 ---
-    std::cout << "\nPerforming iteration 0\n";
+    output << "\nPerforming iteration 0\n";
 
-    std::cout << "Calculating the initial Fock matrix\n";
-    auto fock_mtx = inital_fock_guess_matrix(initial_fock, overlap_mtx, core_hamiltonian_mtx);
+    // the iterations work in buffers that are allocated once, here, instead of in fresh matrices every
+    // iteration; the Fock matrix lives in the workspace, but holds nothing useful until one is built
+    auto workspace = ScfWorkspace {basis.size()};
+    auto& fock_mtx = workspace.fock_mtx;
+    auto is_fock_mtx_built = false;
 
-    maybe_print_divider(is_verbose);
+    auto prev_density_mtx = Eigen::MatrixXd {};
+    auto tot_energy = double {0.0};
 
-    std::cout << "Calculating initial density matrix\n";
-    auto prev_density_mtx = new_density_matrix(fock_mtx, transformation_mtx, n_electrons);
+    auto warm_start_density_mtx = warm_start_density_matrix(options, basis.size());
 
-    auto tot_energy = total_energy(prev_density_mtx, fock_mtx, core_hamiltonian_mtx, atoms);
-    std::cout << "Total energy = " << tot_energy << '\n';
+    auto first_iteration = std::size_t {1};
 
-    // --- REMAINING ITERATIONS ---
-    for (std::size_t i_iter {1}; i_iter <= n_max_iter; ++i_iter) {
-        std::cout << "\nPerforming iteration " << i_iter << '\n';
+    if (checkpoint) {
+        output << "Starting from the density matrix in the checkpoint\n";
+        prev_density_mtx = checkpoint->density_matrix();
+        first_iteration = checkpoint->iteration() + 1;
+
+        if (diis) {
+            for (std::size_t i {0}; i < checkpoint->n_diis_entries(); ++i) {
+                diis->push(checkpoint->diis_fock_matrix(i), checkpoint->diis_error_matrix(i));
+            }
+        }
 
-        std::cout << "Calculating the Fock matrix\n";
-        fock_mtx = fock_matrix(prev_density_mtx, basis, two_electron_integrals, core_hamiltonian_mtx);
+        // nothing else is needed from the file, and it is about to be overwritten by new checkpoints
+        checkpoint.reset();
+    }
+    else if (warm_start_density_mtx) {
+        output << "Starting from the density matrix of an earlier calculation\n";
+        prev_density_mtx = std::move(*warm_start_density_mtx);
+    }
+    else if (initial_fock == InitialFockGuess::SUPERPOSITION_OF_ATOMIC_DENSITIES) {
+        // there is no Fock matrix to calculate an energy from until the first iteration
+        output << "Calculating the initial density matrix from the superposition of atomic densities\n";
+        prev_density_mtx = superposition_of_atomic_densities(atoms, n_electrons);
+    }
+    else {
+        output << "Calculating the initial Fock matrix\n";
+        fock_mtx = inital_fock_guess_matrix(initial_fock, overlap_mtx, core_hamiltonian_mtx);
+        is_fock_mtx_built = true;
 
-        std::cout << "Calculating the density matrix\n";
-        const auto density_mtx = new_density_matrix(fock_mtx, transformation_mtx, n_electrons);
+        maybe_print_divider(output, is_verbose);
+
+        output << "Calculating initial density matrix\n";
+        prev_density_mtx = new_density_matrix(fock_mtx, transformation_mtx, n_electrons);
+
+        tot_energy = total_energy(prev_density_mtx, fock_mtx, core_hamiltonian_mtx, atoms);
+        output << "Total energy = " << tot_energy << '\n';
+    }
+
+    const auto setup_seconds = seconds_since(start_time);
+
+    auto history = std::vector<ScfIterationInfo> {};
+    auto is_converged = false;
+    auto n_iterations = std::size_t {0};
+
+    // --- REMAINING ITERATIONS ---
+    for (std::size_t i_iter {first_iteration}; i_iter <= n_max_iter; ++i_iter) {
+        const auto iteration_start_time = Clock::now();
+        output << "\nPerforming iteration " << i_iter << '\n';
+
+        output << "Calculating the Fock matrix\n";
+        switch (scf_mode) {
+            case ScfMode::CONVENTIONAL : {
+                const auto& integrals = two_electron_integrals;
+                auto& electron_electron_mtx = workspace.electron_electron_mtx;
+                fock_matrix(fock_mtx, electron_electron_mtx, prev_density_mtx, integrals, core_hamiltonian_mtx);
+                break;
+            }
+            case ScfMode::DIRECT : {
+                auto& incremental = *incremental_electron_electron_mtx;
+                fock_mtx.noalias() = core_hamiltonian_mtx + incremental.update(prev_density_mtx);
+
+                const auto build_type = incremental.was_full_rebuild() ? "full" : "incremental";
+                output << "Skipped " << incremental.n_skipped() << " of "
+                       << n_unique_quartets(basis.size()) << " unique two-electron integrals in the "
+                       << build_type << " build\n";
+                break;
+            }
+            case ScfMode::OUT_OF_CORE : {
+                // the file is mapped afresh for every pass, so that the pages read during the previous
+                // pass do not have to be kept in memory between iterations
+                const auto integral_file = TwoElectronIntegralFileReader {two_electron_integral_file->path()};
+                auto& electron_electron_mtx = workspace.electron_electron_mtx;
+                fock_matrix(fock_mtx, electron_electron_mtx, prev_density_mtx, integral_file, core_hamiltonian_mtx);
+                break;
+            }
+            case ScfMode::DENSITY_FITTING :
+            case ScfMode::CHOLESKY : {
+                const auto& integrals = *factorized_integrals;
+                auto& electron_electron_mtx = workspace.electron_electron_mtx;
+                fock_matrix(fock_mtx, electron_electron_mtx, prev_density_mtx, integrals, core_hamiltonian_mtx);
+                break;
+            }
+            default : {
+                throw std::runtime_error {"UNREACHABLE: unknown ScfMode passed to function!"};
+            }
+        }
+        is_fock_mtx_built = true;
+
+        // the density matrix is calculated from the extrapolated Fock matrix, but the energy is still
+        // calculated from the Fock matrix that was actually built
+        auto is_extrapolated = false;
+        auto diis_error = double {0.0};
+        if (diis) {
+            auto& diis_error_mtx = workspace.diis_error_mtx;
+            diis_error_matrix(diis_error_mtx, workspace.fock_density_mtx, fock_mtx, prev_density_mtx, overlap_mtx);
+            diis->push(fock_mtx, diis_error_mtx);
+            diis_error = diis->max_error();
+            print_diis_error(output, diis_error);
+
+            if (i_iter >= options.diis_start_iteration) {
+                output << "Extrapolating the Fock matrix from " << diis->n_stored() << " Fock matrices\n";
+                diis->extrapolate(workspace.extrapolated_fock_mtx);
+                is_extrapolated = true;
+            }
+        }
+
+        output << "Calculating the density matrix\n";
+        const auto& next_fock_mtx = is_extrapolated ? workspace.extrapolated_fock_mtx : fock_mtx;
+        new_density_matrix(next_fock_mtx, transformation_mtx, n_electrons, workspace);
+        const auto& density_mtx = workspace.density_mtx;
 
         tot_energy = total_energy(density_mtx, fock_mtx, core_hamiltonian_mtx, atoms);
-        std::cout << "Total energy = " << tot_energy << '\n';
+        output << "Total energy = " << tot_energy << '\n';
 
-        std::cout << "Calculating the density matrix difference\n";
+        output << "Calculating the density matrix difference\n";
         const auto difference = density_matrix_difference(prev_density_mtx, density_mtx);
-        std::cout << "Density matrix difference = " << std::fixed << std::setprecision(12) << difference << '\n';
+        output << "Density matrix difference = " << std::fixed << std::setprecision(12) << difference << '\n';
+
+        // the old density matrix is not needed anymore, so its buffer holds the next one
+        std::swap(prev_density_mtx, workspace.density_mtx);
+        n_iterations = i_iter;
+        history.push_back({i_iter, tot_energy, difference, diis_error, seconds_since(iteration_start_time)});
+
+        const auto is_last_iteration = (difference < tolerance_change_density_matrix);
+        if (options.checkpoint_path && (is_last_iteration || i_iter % options.checkpoint_period == 0)) {
+            const auto stored_integrals = (scf_mode == ScfMode::CONVENTIONAL)
+                                            ? std::span<const double> {two_electron_integrals.values()}
+                                            : std::span<const double> {};
+            const auto* stored_diis = diis ? &(*diis) : nullptr;
+
+            write_checkpoint_file(
+                *options.checkpoint_path,
+                basis,
+                i_iter,
+                overlap_mtx,
+                core_hamiltonian_mtx,
+                prev_density_mtx,
+                stored_diis,
+                stored_integrals
+            );
+            output << "Wrote a checkpoint to '" << options.checkpoint_path->string() << "'\n";
+        }
 
-        if (difference < tolerance_change_density_matrix) {
-            std::cout << "\nConverged!\n";
-            std::cout << "The total energy is " << tot_energy << " A.U. \n";
-            return;
+        if (is_last_iteration) {
+            output << "\nConverged!\n";
+            output << "The total energy is " << tot_energy << " A.U. \n";
+            is_converged = true;
+            break;
         }
 
-        prev_density_mtx = density_mtx.eval();
+        maybe_print_divider(output, is_verbose);
+    }
+
+    if (!is_converged) {
+        output << "Failed to converge!\n";
+    }
 
-        maybe_print_divider(is_verbose);
+    // the orbitals of the last Fock matrix that was built; once the calculation has converged, they are
+    // the orbitals that the final density matrix is made from (a calculation that starts from a density
+    // matrix, and performs no iterations, has no Fock matrix to take orbitals from)
+    auto orbitals = MolecularOrbitals {};
+    if (is_fock_mtx_built) {
+        orbitals = molecular_orbitals(fock_mtx, transformation_mtx);
     }
 
-    std::cout << "Failed to converge!\n";
+    return RestrictedHartreeFockResult {
+        .is_converged = is_converged,
+        .n_iterations = n_iterations,
+        .total_energy = tot_energy,
+        .orbital_energies = std::move(orbitals.energies),
+        .coefficient_mtx = std::move(orbitals.coefficient_mtx),
+        .density_mtx = std::move(prev_density_mtx),
+        .fock_mtx = is_fock_mtx_built ? std::move(fock_mtx) : Eigen::MatrixXd {},
+        .history = std::move(history),
+        .setup_seconds = setup_seconds,
+        .total_seconds = seconds_since(start_time)
+    };
 }
 
 }  // namespace elec
@@ -1,4 +1,7 @@
 #include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -60,45 +63,98 @@ auto indices_to_sort(const Eigen::VectorXd& elements) -> std::vector<Eigen::Inde
     return indices;
 }
 
-auto new_density_matrix(
-    const Eigen::MatrixXd& fock_mtx,
-    const Eigen::MatrixXd& basis_transformation_mtx,
-    std::size_t n_electrons
-) -> Eigen::MatrixXd
+auto molecular_orbitals(const Eigen::MatrixXd& fock_mtx, const Eigen::MatrixXd& basis_transformation_mtx)
+    -> MolecularOrbitals
 {
-    const auto fock_mtx_trans = basis_transformation_mtx.transpose() * fock_mtx * basis_transformation_mtx;
+    const auto fock_mtx_trans = (basis_transformation_mtx.transpose() * fock_mtx * basis_transformation_mtx).eval();
 
     const auto eigensolver = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> {fock_mtx_trans};
     if (eigensolver.info() != Eigen::Success) {
         throw std::runtime_error {"Failed to perform eigenvalue decomposition of Fock matrix."};
     }
 
-    // Get the sorted eigenvalues and eigenvectors; later operations depend on acessing the
-    // eigenstates in order of ascending energy, which is why this reordering is required
-    const auto eigenvalues = eigensolver.eigenvalues();
-    const auto sorted_indices = indices_to_sort(eigenvalues);
+    // later operations depend on accessing the eigenstates in order of ascending energy; the solver
+    // already returns the eigenvalues in increasing order, with the eigenvectors in the same order
+    auto coefficient_mtx = (basis_transformation_mtx * eigensolver.eigenvectors()).eval();
 
-    const auto coefficient_mtx_trans = matrix_with_sorted_columns(eigensolver.eigenvectors(), sorted_indices);
-    const auto coefficient_mtx = basis_transformation_mtx * coefficient_mtx_trans;
+    return {eigensolver.eigenvalues(), std::move(coefficient_mtx)};
+}
 
-    const auto new_density_mtx = density_matrix_restricted_hartree_fock(coefficient_mtx, n_electrons);
+auto new_density_matrix(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& basis_transformation_mtx,
+    std::size_t n_electrons
+) -> Eigen::MatrixXd
+{
+    const auto orbitals = molecular_orbitals(fock_mtx, basis_transformation_mtx);
 
-    return new_density_mtx;
+    return density_matrix_restricted_hartree_fock(orbitals.coefficient_mtx, n_electrons);
 }
 
-auto density_matrix_difference(const Eigen::MatrixXd& old_density_mtx, const Eigen::MatrixXd& new_density_mtx) -> double
+ScfWorkspace::ScfWorkspace(std::size_t n_basis_functions)
 {
-    const auto size = old_density_mtx.cols();
+    const auto size = static_cast<Eigen::Index>(n_basis_functions);
+
+    fock_mtx.resize(size, size);
+    electron_electron_mtx.resize(size, size);
+    half_transformed_fock_mtx.resize(size, size);
+    transformed_fock_mtx.resize(size, size);
+    eigensolver = Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> {size};
+    orbital_energies.resize(size);
+    coefficient_mtx.resize(size, size);
+    density_mtx.resize(size, size);
+    diis_error_mtx.resize(size, size);
+    fock_density_mtx.resize(size, size);
+    extrapolated_fock_mtx.resize(size, size);
+}
 
-    auto difference = double {0.0};
-    for (Eigen::Index i0 {0}; i0 < size; ++i0) {
-        for (Eigen::Index i1 {0}; i1 < size; ++i1) {
-            const auto element_diff = new_density_mtx(i0, i1) - old_density_mtx(i0, i1);
-            difference += element_diff * element_diff;
-        }
+auto ScfWorkspace::n_basis_functions() const noexcept -> std::size_t
+{
+    return static_cast<std::size_t>(orbital_energies.size());
+}
+
+void molecular_orbitals(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& basis_transformation_mtx,
+    ScfWorkspace& workspace
+)
+{
+    const auto size = static_cast<Eigen::Index>(workspace.n_basis_functions());
+    if (fock_mtx.rows() != size || fock_mtx.cols() != size) {
+        throw std::runtime_error {"The Fock matrix does not match the size of the SCF workspace."};
     }
 
-    return 0.5 * std::sqrt(difference);
+    // the products are written straight into the buffers, without the temporaries that Eigen would
+    // otherwise create to guard against aliasing
+    workspace.half_transformed_fock_mtx.noalias() = basis_transformation_mtx.transpose() * fock_mtx;
+    workspace.transformed_fock_mtx.noalias() = workspace.half_transformed_fock_mtx * basis_transformation_mtx;
+
+    auto& eigensolver = workspace.eigensolver;
+    eigensolver.compute(workspace.transformed_fock_mtx);
+    if (eigensolver.info() != Eigen::Success) {
+        throw std::runtime_error {"Failed to perform eigenvalue decomposition of Fock matrix."};
+    }
+
+    // the eigenvalues are already in increasing order, as in `molecular_orbitals()`
+    workspace.orbital_energies = eigensolver.eigenvalues();
+    workspace.coefficient_mtx.noalias() = basis_transformation_mtx * eigensolver.eigenvectors();
+}
+
+void new_density_matrix(
+    const Eigen::MatrixXd& fock_mtx,
+    const Eigen::MatrixXd& basis_transformation_mtx,
+    std::size_t n_electrons,
+    ScfWorkspace& workspace
+)
+{
+    molecular_orbitals(fock_mtx, basis_transformation_mtx, workspace);
+    density_matrix_restricted_hartree_fock(workspace.density_mtx, workspace.coefficient_mtx, n_electrons);
+}
+
+auto density_matrix_difference(const Eigen::MatrixXd& old_density_mtx, const Eigen::MatrixXd& new_density_mtx) -> double
+{
+    // half of the Frobenius norm of the difference
+    return 0.5 * (new_density_mtx - old_density_mtx).norm();
 }
 
 auto electron_energy(
@@ -107,17 +163,8 @@ auto electron_energy(
     const Eigen::MatrixXd& core_hamiltonain_mtx
 ) -> double
 {
-    const auto size = density_mtx.cols();
-
-    auto energy = double {0.0};
-
-    for (Eigen::Index i0 {0}; i0 < size; ++i0) {
-        for (Eigen::Index i1 {0}; i1 < size; ++i1) {
-            energy += 0.5 * density_mtx(i0, i1) * (fock_mtx(i0, i1) + core_hamiltonain_mtx(i0, i1));
-        }
-    }
-
-    return energy;
+    // 0.5 * sum_{i0, i1} D(i0, i1) [F(i0, i1) + H(i0, i1)], as a single element-wise reduction
+    return 0.5 * density_mtx.cwiseProduct(fock_mtx + core_hamiltonain_mtx).sum();
 }
 
 auto nuclear_energy(const std::vector<AtomInfo>& atoms) -> double
@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/batch/batch_runner.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+/*
+    The input file for the water molecule of `elec_test::get_h2o_atoms()`, with the options of
+    `elec_test::water_options()`; the coordinates are written with enough digits to be read back exactly.
+*/
+auto water_input() -> std::string
+{
+    auto stream = std::ostringstream {};
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    stream << "positions = [\n";
+    for (const auto& atom : elec_test::get_h2o_atoms()) {
+        const auto& pos = atom.position;
+        stream << "    [\"" << elec::atom_name_from_label(atom.label) << "\", " << pos.x << ", " << pos.y << ", "
+               << pos.z << "],\n";
+    }
+    stream << "]\n";
+
+    stream << R"(initial_fock_guess = "core_hamiltonian"
+max_hartree_fock_iterations = 100
+tol_change_density_matrix = 1.0e-8
+n_electrons = 10
+verbose = false
+)";
+
+    return stream.str();
+}
+
+constexpr auto HYDROGEN_MOLECULE_INPUT = R"(
+positions = [
+    ["H", 0.0, 0.0, 0.0],
+    ["H", 0.0, 0.0, 1.4],
+]
+initial_fock_guess = "core_hamiltonian"
+max_hartree_fock_iterations = 100
+tol_change_density_matrix = 1.0e-8
+n_electrons = 2
+verbose = false
+)";
+
+/*
+    A directory of input files in the temporary directory, which is removed at the end of the test.
+*/
+class TemporaryDirectory
+{
+public:
+    explicit TemporaryDirectory(const char* name)
+        : path_ {std::filesystem::temp_directory_path() / name}
+    {
+        std::filesystem::remove_all(path_);
+        std::filesystem::create_directories(path_);
+    }
+
+    ~TemporaryDirectory()
+    {
+        auto error = std::error_code {};
+        std::filesystem::remove_all(path_, error);
+    }
+
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    auto operator=(const TemporaryDirectory&) -> TemporaryDirectory& = delete;
+
+    auto write(const char* filename, const std::string& contents) const -> std::filesystem::path
+    {
+        const auto path = path_ / filename;
+        auto stream = std::ofstream {path};
+        stream << contents;
+
+        return path;
+    }
+
+    auto path() const -> const std::filesystem::path&
+    {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+auto count_lines(const std::string& text) -> std::size_t
+{
+    return static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n'));
+}
+
+}  // anonymous namespace
+
+TEST_CASE("batch input files")
+{
+    const auto directory = TemporaryDirectory {"elecstruct_batch_input_files"};
+    const auto water_path = directory.write("water.toml", water_input());
+    const auto hydrogen_path = directory.write("hydrogen.toml", HYDROGEN_MOLECULE_INPUT);
+    directory.write("notes.txt", "not an input file");
+
+    SECTION("every toml file in a directory, in alphabetical order")
+    {
+        const auto paths = elec::batch_input_files(directory.path());
+        REQUIRE(paths == std::vector<std::filesystem::path> {hydrogen_path, water_path});
+    }
+
+    SECTION("every path in a manifest, relative to the manifest")
+    {
+        const auto manifest_path = directory.write("manifest.txt", "# comment\nwater.toml\n\n  hydrogen.toml  \n");
+
+        const auto paths = elec::batch_input_files(manifest_path);
+        REQUIRE(paths == std::vector<std::filesystem::path> {water_path, hydrogen_path});
+    }
+
+    SECTION("missing manifest throws")
+    {
+        REQUIRE_THROWS_AS(elec::batch_input_files(directory.path() / "missing.txt"), std::runtime_error);
+    }
+}
+
+TEST_CASE("run batch")
+{
+    const auto directory = TemporaryDirectory {"elecstruct_run_batch"};
+
+    const auto input_paths = std::vector<std::filesystem::path> {
+        directory.write("water.toml", water_input()),
+        directory.write("hydrogen.toml", HYDROGEN_MOLECULE_INPUT),
+        directory.write("broken.toml", "positions = [\n"),
+        directory.path() / "missing.toml",
+        directory.write("water_again.toml", water_input())
+    };
+
+    auto options = elec::BatchOptions {};
+    options.n_threads = 3;
+
+    auto results_output = std::stringstream {};
+    const auto results = elec::run_batch(input_paths, options, results_output);
+
+    SECTION("one result per job, in the order of the inputs")
+    {
+        REQUIRE(results.size() == input_paths.size());
+        for (std::size_t i {0}; i < results.size(); ++i) {
+            REQUIRE(results[i].input_path == input_paths[i]);
+        }
+    }
+
+    SECTION("the calculations converge to the right energies")
+    {
+        REQUIRE(results[0].status == elec::BatchJobStatus::CONVERGED);
+        REQUIRE(results[4].status == elec::BatchJobStatus::CONVERGED);
+        REQUIRE_THAT(results[0].total_energy, Catch::Matchers::WithinAbs(elec_test::WATER_STO3G_ENERGY, 1.0e-7));
+        REQUIRE_THAT(results[4].total_energy, Catch::Matchers::WithinAbs(elec_test::WATER_STO3G_ENERGY, 1.0e-7));
+
+        REQUIRE(results[1].status == elec::BatchJobStatus::CONVERGED);
+        REQUIRE(results[1].total_energy < 0.0);
+    }
+
+    SECTION("a failed job does not stop the others")
+    {
+        REQUIRE(results[2].status == elec::BatchJobStatus::FAILED);
+        REQUIRE(results[3].status == elec::BatchJobStatus::FAILED);
+        REQUIRE(!results[2].error_message.empty());
+        REQUIRE(!results[3].error_message.empty());
+    }
+
+    SECTION("only the result lines are written, one per job")
+    {
+        const auto text = results_output.str();
+        REQUIRE(count_lines(text) == input_paths.size());
+
+        for (const auto& result : results) {
+            REQUIRE(text.find(elec::format_batch_job_result(result)) != std::string::npos);
+        }
+    }
+}
+
+TEST_CASE("run batch with log files")
+{
+    const auto directory = TemporaryDirectory {"elecstruct_run_batch_logs"};
+    const auto input_paths = std::vector<std::filesystem::path> {
+        directory.write("water.toml", water_input()),
+        directory.write("hydrogen.toml", HYDROGEN_MOLECULE_INPUT)
+    };
+
+    auto options = elec::BatchOptions {};
+    options.n_threads = 2;
+    options.log_directory = directory.path() / "logs";
+
+    auto results_output = std::stringstream {};
+    elec::run_batch(input_paths, options, results_output);
+
+    for (const auto* name : {"0_water.log", "1_hydrogen.log"}) {
+        auto log_stream = std::ifstream {*options.log_directory / name};
+        REQUIRE(log_stream.is_open());
+
+        const auto log = std::string {std::istreambuf_iterator<char> {log_stream}, std::istreambuf_iterator<char> {}};
+        REQUIRE(log.find("Converged!") != std::string::npos);
+    }
+}
+
+TEST_CASE("run batch with log files for inputs with the same stem")
+{
+    const auto directory = TemporaryDirectory {"elecstruct_run_batch_same_stem"};
+    std::filesystem::create_directories(directory.path() / "a");
+    std::filesystem::create_directories(directory.path() / "b");
+
+    const auto input_paths = std::vector<std::filesystem::path> {
+        directory.write("a/molecule.toml", water_input()),
+        directory.write("b/molecule.toml", HYDROGEN_MOLECULE_INPUT)
+    };
+
+    auto options = elec::BatchOptions {};
+    options.n_threads = 2;
+    options.log_directory = directory.path() / "logs";
+
+    auto results_output = std::stringstream {};
+    elec::run_batch(input_paths, options, results_output);
+
+    const auto read_log = [&](const char* name)
+    {
+        auto log_stream = std::ifstream {*options.log_directory / name};
+        REQUIRE(log_stream.is_open());
+
+        return std::string {std::istreambuf_iterator<char> {log_stream}, std::istreambuf_iterator<char> {}};
+    };
+
+    // each job writes to its own log file, so each log holds exactly one calculation
+    for (const auto* name : {"0_molecule.log", "1_molecule.log"}) {
+        const auto log = read_log(name);
+        REQUIRE(log.find("Converged!") != std::string::npos);
+        REQUIRE(log.find("Converged!") == log.rfind("Converged!"));
+    }
+}
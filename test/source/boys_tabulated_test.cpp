@@ -0,0 +1,98 @@
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/integrals/boys.hpp"
+#include "elecstruct/integrals/boys_tabulated.hpp"
+
+namespace
+{
+
+// covers both sides of the switch between branches in both implementations, and the points
+// halfway between two grid points, where the Taylor expansion is at its least accurate
+auto boys_test_arguments() -> std::vector<double>
+{
+    auto xs = std::vector<double> {0.0, 1.0e-10, 1.0e-3, 0.05, 0.15, 4.5425, 4.5426, 29.95, 30.0, 30.01, 45.0, 120.0};
+    for (std::size_t i {0}; i < 400; ++i) {
+        xs.push_back(0.0123 + 0.1 * static_cast<double>(i));
+    }
+
+    return xs;
+}
+
+}  // anonymous namespace
+
+TEST_CASE("tabulated Boys function")
+{
+    constexpr auto REL_TOL = 1.0e-12;
+
+    SECTION("matches the Beylkin-Sharma implementation for every order")
+    {
+        const auto order = static_cast<std::size_t>(GENERATE(range(0, 13)));
+
+        for (const auto x : boys_test_arguments()) {
+            const auto actual = elec::boys_tabulated(x, order);
+            const auto expected = elec::boys_beylkin_sharma(x, order);
+
+            REQUIRE_THAT(actual, Catch::Matchers::WithinRel(expected, REL_TOL));
+        }
+    }
+
+    SECTION("all orders at once match the single-order function")
+    {
+        const auto n_max = static_cast<std::size_t>(GENERATE(range(0, 13)));
+
+        for (const auto x : boys_test_arguments()) {
+            auto values = std::array<double, elec::BOYS_MAX_ORDER + 1> {};
+            elec::boys_all_orders_tabulated(x, n_max, values);
+
+            for (std::size_t order {0}; order <= n_max; ++order) {
+                REQUIRE_THAT(values[order], Catch::Matchers::WithinRel(elec::boys_tabulated(x, order), 1.0e-15));
+            }
+        }
+    }
+
+    SECTION("the batch function matches the single-order function")
+    {
+        const auto order = static_cast<std::size_t>(GENERATE(range(0, 13)));
+
+        const auto xs = boys_test_arguments();
+        auto values = std::vector<double>(xs.size());
+        elec::boys_tabulated_batch(xs, order, values);
+
+        for (std::size_t i {0}; i < xs.size(); ++i) {
+            REQUIRE_THAT(values[i], Catch::Matchers::WithinRel(elec::boys_tabulated(xs[i], order), 1.0e-15));
+        }
+    }
+
+    SECTION("the batch function handles very large arguments mixed in with small ones")
+    {
+        const auto order = static_cast<std::size_t>(GENERATE(range(0, 13)));
+
+        // the largest arguments would overflow an int if they were converted to a grid index directly
+        const auto xs = std::vector<double> {1.0, 3.0e9, 50.0, 2.5e8, 0.25, 1.0e300, 29.97};
+        auto values = std::vector<double>(xs.size());
+        elec::boys_tabulated_batch(xs, order, values);
+
+        for (std::size_t i {0}; i < xs.size(); ++i) {
+            REQUIRE_THAT(values[i], Catch::Matchers::WithinRel(elec::boys_tabulated(xs[i], order), 1.0e-15));
+        }
+    }
+
+    SECTION("invalid arguments throw")
+    {
+        auto values = std::array<double, elec::BOYS_MAX_ORDER + 2> {};
+        REQUIRE_THROWS_AS(elec::boys_tabulated(1.0, elec::BOYS_MAX_ORDER + 1), std::runtime_error);
+        REQUIRE_THROWS_AS(elec::boys_all_orders_tabulated(1.0, elec::BOYS_MAX_ORDER + 1, values), std::runtime_error);
+
+        const auto xs = std::vector<double> {1.0, 2.0};
+        auto too_few_values = std::vector<double>(1);
+        REQUIRE_THROWS_AS(elec::boys_tabulated_batch(xs, 0, too_few_values), std::runtime_error);
+    }
+}
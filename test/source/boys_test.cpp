@@ -1,5 +1,7 @@
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <stdexcept>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
@@ -143,3 +145,32 @@ TEST_CASE("Boys function fast implmenetaiton")
 
     REQUIRE_THAT(actual, Catch::Matchers::WithinAbs(expected, ABS_TOL));
 }
+
+TEST_CASE("Boys function, all orders at once")
+{
+    SECTION("every order matches the single-order function")
+    {
+        const auto n_max = static_cast<std::size_t>(GENERATE(range(0, 13)));
+        const auto i_input = static_cast<std::size_t>(GENERATE(range(0, 13)));
+        const auto x = boys_fast_input[i_input];
+
+        auto values = std::array<double, elec::BOYS_MAX_ORDER + 1> {};
+        elec::boys_all_orders(x, n_max, values);
+
+        for (std::size_t order {0}; order <= n_max; ++order) {
+            REQUIRE(values[order] == elec::boys_beylkin_sharma(x, order));
+        }
+    }
+
+    SECTION("orders above the maximum throw")
+    {
+        auto values = std::array<double, elec::BOYS_MAX_ORDER + 2> {};
+        REQUIRE_THROWS_AS(elec::boys_all_orders(1.0, elec::BOYS_MAX_ORDER + 1, values), std::runtime_error);
+    }
+
+    SECTION("a buffer that is too small throws")
+    {
+        auto values = std::array<double, 3> {};
+        REQUIRE_THROWS_AS(elec::boys_all_orders(1.0, 3, values), std::runtime_error);
+    }
+}
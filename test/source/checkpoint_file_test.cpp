@@ -0,0 +1,277 @@
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/restricted_hartree_fock/checkpoint_file.hpp"
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+#include "elecstruct/restricted_hartree_fock/restricted_hartree_fock.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+/*
+    A path in the temporary directory, which removes the file at the end of the test.
+*/
+class TemporaryPath
+{
+public:
+    explicit TemporaryPath(const char* filename)
+        : path_ {std::filesystem::temp_directory_path() / filename}
+    {
+        std::filesystem::remove(path_);
+    }
+
+    ~TemporaryPath()
+    {
+        auto error = std::error_code {};
+        std::filesystem::remove(path_, error);
+    }
+
+    TemporaryPath(const TemporaryPath&) = delete;
+    auto operator=(const TemporaryPath&) -> TemporaryPath& = delete;
+
+    auto path() const -> const std::filesystem::path&
+    {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+}  // anonymous namespace
+
+TEST_CASE("checkpoint file round trip")
+{
+    const auto temporary = TemporaryPath {"elecstruct_checkpoint_round_trip.chk"};
+
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto size = static_cast<Eigen::Index>(basis.size());
+
+    const auto overlap_mtx = Eigen::MatrixXd::Random(size, size).eval();
+    const auto core_hamiltonian_mtx = Eigen::MatrixXd::Random(size, size).eval();
+    const auto density_mtx = Eigen::MatrixXd::Random(size, size).eval();
+
+    auto diis = elec::DiisExtrapolator {2};
+    const auto fock_mtxs = std::vector<Eigen::MatrixXd> {
+        Eigen::MatrixXd::Random(size, size),
+        Eigen::MatrixXd::Random(size, size),
+        Eigen::MatrixXd::Random(size, size)
+    };
+    const auto error_mtxs = std::vector<Eigen::MatrixXd> {
+        Eigen::MatrixXd::Random(size, size),
+        Eigen::MatrixXd::Random(size, size),
+        Eigen::MatrixXd::Random(size, size)
+    };
+    for (std::size_t i {0}; i < fock_mtxs.size(); ++i) {
+        diis.push(fock_mtxs[i], error_mtxs[i]);
+    }
+
+    const auto integrals = std::vector<double> {1.0, -2.5, 3.25, 0.0, 1.0e-12};
+
+    SECTION("everything that is written is read back")
+    {
+        elec::write_checkpoint_file(
+            temporary.path(), basis, 7, overlap_mtx, core_hamiltonian_mtx, density_mtx, &diis, integrals
+        );
+
+        const auto reader = elec::CheckpointFileReader {temporary.path()};
+
+        REQUIRE(reader.n_basis_functions() == basis.size());
+        REQUIRE(reader.iteration() == 7);
+        REQUIRE(reader.matches_basis(basis));
+
+        REQUIRE(reader.overlap_matrix() == overlap_mtx);
+        REQUIRE(reader.core_hamiltonian_matrix() == core_hamiltonian_mtx);
+        REQUIRE(reader.density_matrix() == density_mtx);
+
+        // only the two most recent entries fit in the history
+        REQUIRE(reader.n_diis_entries() == 2);
+        REQUIRE(reader.diis_fock_matrix(0) == fock_mtxs[1]);
+        REQUIRE(reader.diis_fock_matrix(1) == fock_mtxs[2]);
+        REQUIRE(reader.diis_error_matrix(0) == error_mtxs[1]);
+        REQUIRE(reader.diis_error_matrix(1) == error_mtxs[2]);
+        REQUIRE_THROWS_AS(reader.diis_fock_matrix(2), std::runtime_error);
+
+        const auto read_integrals = reader.two_electron_integrals();
+        REQUIRE(std::vector<double> {read_integrals.begin(), read_integrals.end()} == integrals);
+
+        const auto functions = reader.basis_functions();
+        REQUIRE(functions.size() == basis.size());
+        REQUIRE(functions[5].position[1] == basis[5].position.y);
+    }
+
+    SECTION("the DIIS history and the integrals are optional")
+    {
+        elec::write_checkpoint_file(
+            temporary.path(), basis, 3, overlap_mtx, core_hamiltonian_mtx, density_mtx, nullptr, {}
+        );
+
+        const auto reader = elec::CheckpointFileReader {temporary.path()};
+
+        REQUIRE(reader.n_diis_entries() == 0);
+        REQUIRE(reader.two_electron_integrals().empty());
+        REQUIRE(reader.density_matrix() == density_mtx);
+    }
+
+    SECTION("rewriting replaces the previous checkpoint, without leaving a temporary file")
+    {
+        elec::write_checkpoint_file(
+            temporary.path(), basis, 1, overlap_mtx, core_hamiltonian_mtx, density_mtx, &diis, integrals
+        );
+        elec::write_checkpoint_file(
+            temporary.path(), basis, 2, overlap_mtx, core_hamiltonian_mtx, density_mtx, nullptr, {}
+        );
+
+        const auto reader = elec::CheckpointFileReader {temporary.path()};
+        REQUIRE(reader.iteration() == 2);
+        REQUIRE(reader.n_diis_entries() == 0);
+
+        auto temporary_path = temporary.path();
+        temporary_path += ".tmp";
+        REQUIRE(!std::filesystem::exists(temporary_path));
+    }
+
+    SECTION("a matrix of the wrong size throws")
+    {
+        const auto wrong_mtx = Eigen::MatrixXd::Random(size + 1, size + 1).eval();
+
+        REQUIRE_THROWS_AS(
+            elec::write_checkpoint_file(
+                temporary.path(), basis, 1, wrong_mtx, core_hamiltonian_mtx, density_mtx, nullptr, {}
+            ),
+            std::runtime_error
+        );
+    }
+}
+
+TEST_CASE("checkpoint file basis hash")
+{
+    const auto basis = elec_test::get_h2o_basis();
+
+    SECTION("the same basis gives the same hash")
+    {
+        const auto again = elec_test::get_h2o_basis();
+        REQUIRE(elec::basis_hash(basis) == elec::basis_hash(again));
+    }
+
+    SECTION("moving an atom changes the hash")
+    {
+        const auto moved = elec::create_atomic_orbitals_sto3g(elec_test::get_h2o_atoms(1.5));
+        REQUIRE(elec::basis_hash(basis) != elec::basis_hash(moved));
+    }
+}
+
+TEST_CASE("checkpoint file reader rejects invalid files")
+{
+    const auto temporary = TemporaryPath {"elecstruct_checkpoint_invalid.chk"};
+
+    SECTION("missing file")
+    {
+        REQUIRE_THROWS_AS(elec::CheckpointFileReader {temporary.path()}, std::runtime_error);
+    }
+
+    SECTION("not a checkpoint file")
+    {
+        {
+            auto stream = std::ofstream {temporary.path()};
+            for (std::size_t i {0}; i < 20; ++i) {
+                stream << "this is not a checkpoint file\n";
+            }
+        }
+
+        REQUIRE_THROWS_AS(elec::CheckpointFileReader {temporary.path()}, std::runtime_error);
+    }
+
+    SECTION("truncated file")
+    {
+        const auto basis = elec_test::get_h2o_basis();
+        const auto size = static_cast<Eigen::Index>(basis.size());
+        const auto matrix = Eigen::MatrixXd::Identity(size, size).eval();
+
+        elec::write_checkpoint_file(temporary.path(), basis, 1, matrix, matrix, matrix, nullptr, {});
+        std::filesystem::resize_file(temporary.path(), std::filesystem::file_size(temporary.path()) - 8);
+
+        REQUIRE_THROWS_AS(elec::CheckpointFileReader {temporary.path()}, std::runtime_error);
+    }
+}
+
+TEST_CASE("restricted Hartree-Fock restart from checkpoint")
+{
+    const auto temporary = TemporaryPath {"elecstruct_checkpoint_restart.chk"};
+
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+
+    const auto reference = elec::perform_restricted_hartree_fock(atoms, basis, elec_test::water_options());
+
+    // the first calculation gets cut short, the way a calculation that gets killed would be
+    auto interrupted_options = elec_test::water_options();
+    interrupted_options.n_max_iter = 4;
+    interrupted_options.checkpoint_path = temporary.path();
+    interrupted_options.checkpoint_period = 2;
+
+    const auto interrupted = elec::perform_restricted_hartree_fock(atoms, basis, interrupted_options);
+    REQUIRE(!interrupted.is_converged);
+
+    SECTION("resumes from the last checkpoint, and converges to the same energy")
+    {
+        auto restart_options = elec_test::water_options();
+        restart_options.checkpoint_path = temporary.path();
+        restart_options.restart_from_checkpoint = true;
+
+        const auto restarted = elec::perform_restricted_hartree_fock(atoms, basis, restart_options);
+
+        REQUIRE(restarted.is_converged);
+        REQUIRE_THAT(restarted.total_energy, Catch::Matchers::WithinAbs(elec_test::WATER_STO3G_ENERGY, 1.0e-7));
+        REQUIRE_THAT(restarted.total_energy, Catch::Matchers::WithinAbs(reference.total_energy, 1.0e-7));
+
+        // the iterations before the checkpoint are not repeated
+        REQUIRE(restarted.history.front().iteration > interrupted_options.checkpoint_period);
+        REQUIRE(restarted.n_iterations <= reference.n_iterations);
+    }
+
+    SECTION("a checkpoint for a different basis throws")
+    {
+        const auto moved_atoms = elec_test::get_h2o_atoms(1.5);
+        const auto moved_basis = elec::create_atomic_orbitals_sto3g(moved_atoms);
+
+        auto restart_options = elec_test::water_options();
+        restart_options.checkpoint_path = temporary.path();
+        restart_options.restart_from_checkpoint = true;
+
+        REQUIRE_THROWS_AS(
+            elec::perform_restricted_hartree_fock(moved_atoms, moved_basis, restart_options), std::runtime_error
+        );
+    }
+
+    SECTION("restarting without a checkpoint path throws")
+    {
+        auto restart_options = elec_test::water_options();
+        restart_options.restart_from_checkpoint = true;
+
+        REQUIRE_THROWS_AS(elec::perform_restricted_hartree_fock(atoms, basis, restart_options), std::runtime_error);
+    }
+
+    SECTION("a checkpoint period of zero throws")
+    {
+        auto zero_period_options = elec_test::water_options();
+        zero_period_options.checkpoint_path = temporary.path();
+        zero_period_options.checkpoint_period = 0;
+
+        REQUIRE_THROWS_AS(elec::perform_restricted_hartree_fock(atoms, basis, zero_period_options), std::runtime_error);
+    }
+}
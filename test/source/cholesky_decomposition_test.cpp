@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "elecstruct/integrals/cholesky_decomposition.hpp"
+#include "elecstruct/integrals/factorized_two_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+/*
+    The largest error in any two-electron integral, when it is rebuilt from the factors.
+*/
+auto max_integral_error(
+    const elec::FactorizedTwoElectronIntegrals& factorized,
+    const elec::TwoElectronIntegralGrid& grid
+) -> double
+{
+    const auto size = factorized.n_basis_functions();
+    const auto size_eig = static_cast<Eigen::Index>(size);
+    const auto& vectors = factorized.vectors();
+
+    auto max_error = double {0.0};
+    for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {size}) {
+        auto approx = double {0.0};
+        for (std::size_t i_vec {0}; i_vec < factorized.n_vectors(); ++i_vec) {
+            const auto offset = static_cast<Eigen::Index>(i_vec) * size_eig;
+            const auto left = vectors(static_cast<Eigen::Index>(i0), offset + static_cast<Eigen::Index>(i1));
+            const auto right = vectors(static_cast<Eigen::Index>(i2), offset + static_cast<Eigen::Index>(i3));
+            approx += left * right;
+        }
+
+        max_error = std::max(max_error, std::fabs(approx - grid.get(i0, i1, i2, i3)));
+    }
+
+    return max_error;
+}
+
+}  // anonymous namespace
+
+TEST_CASE("pivoted Cholesky decomposition of the two-electron integrals")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto n_pairs = basis.size() * (basis.size() + 1) / 2;
+
+    const auto grid = elec::two_electron_integral_grid(shell_pairs);
+
+    SECTION("the error in every integral is bounded by the threshold")
+    {
+        const auto threshold = GENERATE(1.0e-2, 1.0e-4, 1.0e-6, 1.0e-10);
+        const auto decomposed = elec::cholesky_decomposed_integrals(shell_pairs, threshold);
+
+        REQUIRE(decomposed.n_basis_functions() == basis.size());
+        REQUIRE(decomposed.n_vectors() <= n_pairs);
+        REQUIRE(max_integral_error(decomposed, grid) < threshold);
+    }
+
+    SECTION("a looser threshold needs fewer vectors")
+    {
+        const auto loose = elec::cholesky_decomposed_integrals(shell_pairs, 1.0e-2);
+        const auto tight = elec::cholesky_decomposed_integrals(shell_pairs, 1.0e-8);
+
+        REQUIRE(loose.n_vectors() < tight.n_vectors());
+    }
+
+    SECTION("a tight threshold reproduces the exact Coulomb and exchange matrices")
+    {
+        const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.6);
+        const auto exact = elec::coulomb_exchange_matrices(density_mtx, grid);
+
+        const auto decomposed = elec::cholesky_decomposed_integrals(shell_pairs, 1.0e-12);
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, decomposed);
+
+        REQUIRE(coulomb_mtx.isApprox(exact.coulomb, 1.0e-9));
+        REQUIRE(exchange_mtx.isApprox(exact.exchange, 1.0e-9));
+    }
+
+    SECTION("throws for a negative threshold")
+    {
+        REQUIRE_THROWS_AS(elec::cholesky_decomposed_integrals(shell_pairs, -1.0e-6), std::runtime_error);
+    }
+}
+
+TEST_CASE("factorized two-electron integrals")
+{
+    SECTION("throws if the vectors do not match the number of basis functions")
+    {
+        REQUIRE_THROWS_AS(elec::FactorizedTwoElectronIntegrals(3, Eigen::MatrixXd::Zero(4, 8)), std::runtime_error);
+        REQUIRE_THROWS_AS(elec::FactorizedTwoElectronIntegrals(4, Eigen::MatrixXd::Zero(4, 7)), std::runtime_error);
+    }
+
+    SECTION("no vectors give zero matrices")
+    {
+        const auto factorized = elec::FactorizedTwoElectronIntegrals {3, Eigen::MatrixXd::Zero(3, 0)};
+        const auto density_mtx = Eigen::MatrixXd::Identity(3, 3).eval();
+
+        REQUIRE(factorized.n_vectors() == 0);
+        REQUIRE(factorized.coulomb_matrix(density_mtx).isZero());
+        REQUIRE(factorized.exchange_matrix(density_mtx).isZero());
+    }
+}
@@ -0,0 +1,104 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/two_electron_integral_grid.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+/*
+    The Coulomb and exchange matrices, straight from their definitions; every element is a sum over
+    all N^2 pairs (i2, i3).
+*/
+auto reference_coulomb_exchange_matrices(
+    const Eigen::MatrixXd& density_mtx,
+    const elec::TwoElectronIntegralGrid& grid
+) -> elec::CoulombExchangeMatrices
+{
+    const auto size = static_cast<std::size_t>(density_mtx.rows());
+    const auto size_eig = density_mtx.rows();
+
+    auto coulomb_mtx = Eigen::MatrixXd::Zero(size_eig, size_eig).eval();
+    auto exchange_mtx = Eigen::MatrixXd::Zero(size_eig, size_eig).eval();
+
+    for (std::size_t i0 {0}; i0 < size; ++i0) {
+        for (std::size_t i1 {0}; i1 < size; ++i1) {
+            for (std::size_t i2 {0}; i2 < size; ++i2) {
+                for (std::size_t i3 {0}; i3 < size; ++i3) {
+                    const auto density = density_mtx(static_cast<Eigen::Index>(i2), static_cast<Eigen::Index>(i3));
+                    const auto i0_eig = static_cast<Eigen::Index>(i0);
+                    const auto i1_eig = static_cast<Eigen::Index>(i1);
+
+                    coulomb_mtx(i0_eig, i1_eig) += density * grid.get(i0, i1, i2, i3);
+                    exchange_mtx(i0_eig, i1_eig) += density * grid.get(i0, i3, i2, i1);
+                }
+            }
+        }
+    }
+
+    return {coulomb_mtx, exchange_mtx};
+}
+
+}  // anonymous namespace
+
+TEST_CASE("Coulomb and exchange matrices")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.4);
+
+    SECTION("match the definitions, for the full grid")
+    {
+        const auto grid = elec::two_electron_integral_grid(shell_pairs);
+        const auto expected = reference_coulomb_exchange_matrices(density_mtx, grid);
+
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, grid);
+
+        REQUIRE(coulomb_mtx.isApprox(expected.coulomb, 1.0e-12));
+        REQUIRE(exchange_mtx.isApprox(expected.exchange, 1.0e-12));
+        REQUIRE(elec::coulomb_matrix(density_mtx, grid).isApprox(expected.coulomb, 1.0e-12));
+        REQUIRE(elec::exchange_matrix(density_mtx, grid).isApprox(expected.exchange, 1.0e-12));
+    }
+
+    SECTION("match the definitions, for a screened grid")
+    {
+        const auto screening = elec::SchwarzScreening {shell_pairs, 1.0e-2};
+        const auto [grid, n_skipped] = elec::screened_two_electron_integral_grid(shell_pairs, screening);
+        REQUIRE(n_skipped > 0);
+
+        const auto expected = reference_coulomb_exchange_matrices(density_mtx, grid);
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, grid);
+
+        REQUIRE(coulomb_mtx.isApprox(expected.coulomb, 1.0e-12));
+        REQUIRE(exchange_mtx.isApprox(expected.exchange, 1.0e-12));
+    }
+
+    SECTION("make up the two-electron matrix")
+    {
+        const auto grid = elec::two_electron_integral_grid(shell_pairs);
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, grid);
+
+        const auto expected = (coulomb_mtx - 0.5 * exchange_mtx).eval();
+        const auto actual = elec::electron_electron_matrix(basis, density_mtx, grid);
+
+        REQUIRE(actual.isApprox(expected, 1.0e-12));
+    }
+
+    SECTION("throws if the grid does not match the density matrix")
+    {
+        const auto grid = elec::two_electron_integral_grid(shell_pairs);
+        const auto wrong_density_mtx = elec_test::fake_density_matrix(basis.size() + 1, 0.4);
+
+        REQUIRE_THROWS_AS(elec::coulomb_exchange_matrices(wrong_density_mtx, grid), std::runtime_error);
+    }
+}
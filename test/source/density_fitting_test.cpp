@@ -0,0 +1,122 @@
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+
+#include "elecstruct/basis/auxiliary_basis.hpp"
+#include "elecstruct/integrals/density_fitting.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "test_fixtures.hpp"
+
+TEST_CASE("even-tempered auxiliary basis")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto ratio = elec::DEFAULT_EVEN_TEMPERED_RATIO;
+    const auto aux_basis = elec::create_even_tempered_auxiliary_basis(basis, ratio);
+
+    SECTION("every function sits on a centre of the basis, with at most twice its angular momentum")
+    {
+        for (const auto& function : aux_basis) {
+            const auto is_on_oxygen = (function.position.y == 0.0);
+            const auto max_angmom = is_on_oxygen ? 2 : 0;
+
+            REQUIRE(elec::total_angular_momentum(function.angular_momentum) <= max_angmom);
+            REQUIRE(function.exponent > 0.0);
+        }
+    }
+
+    SECTION("the s-type exponents on each centre form a geometric series")
+    {
+        auto s_exponents = std::vector<double> {};
+        for (const auto& function : aux_basis) {
+            if (function.position.y > 0.0 && elec::total_angular_momentum(function.angular_momentum) == 0) {
+                s_exponents.push_back(function.exponent);
+            }
+        }
+
+        REQUIRE(s_exponents.size() >= 2);
+        for (std::size_t i {1}; i < s_exponents.size(); ++i) {
+            REQUIRE(std::fabs(s_exponents[i] / s_exponents[i - 1] - ratio) < 1.0e-12);
+        }
+    }
+
+    SECTION("throws for a ratio that does not grow")
+    {
+        REQUIRE_THROWS_AS(elec::create_even_tempered_auxiliary_basis(basis, 1.0), std::runtime_error);
+    }
+}
+
+TEST_CASE("density fitted Coulomb and exchange matrices")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto aux_basis = elec::create_even_tempered_auxiliary_basis(basis);
+    const auto fitted = elec::density_fitted_integrals(shell_pairs, aux_basis);
+
+    const auto grid = elec::two_electron_integral_grid(shell_pairs);
+    const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.2);
+    const auto exact = elec::coulomb_exchange_matrices(density_mtx, grid);
+
+    REQUIRE(fitted.n_basis_functions() == basis.size());
+    REQUIRE(fitted.n_vectors() == aux_basis.size());
+
+    SECTION("are close to the exact matrices")
+    {
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, fitted);
+
+        REQUIRE(coulomb_mtx.isApprox(exact.coulomb, 1.0e-3));
+        REQUIRE(exchange_mtx.isApprox(exact.exchange, 1.0e-3));
+    }
+
+    SECTION("are symmetric")
+    {
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, fitted);
+
+        REQUIRE(coulomb_mtx.isApprox(coulomb_mtx.transpose(), 1.0e-12));
+        REQUIRE(exchange_mtx.isApprox(exchange_mtx.transpose(), 1.0e-12));
+    }
+
+    SECTION("the fitted Coulomb energy never exceeds the exact Coulomb energy")
+    {
+        const auto coulomb_energy_exact = (exact.coulomb * density_mtx).trace();
+        const auto coulomb_energy_fitted = (fitted.coulomb_matrix(density_mtx) * density_mtx).trace();
+
+        REQUIRE(coulomb_energy_fitted <= coulomb_energy_exact);
+    }
+
+    SECTION("make up the two-electron matrix")
+    {
+        const auto [coulomb_mtx, exchange_mtx] = elec::coulomb_exchange_matrices(density_mtx, fitted);
+
+        const auto expected = (coulomb_mtx - 0.5 * exchange_mtx).eval();
+        const auto actual = elec::electron_electron_matrix(fitted, density_mtx);
+
+        REQUIRE(actual.isApprox(expected, 1.0e-12));
+    }
+
+    SECTION("the in-place Fock matrix matches the one that is returned")
+    {
+        const auto core_hamiltonian_mtx = elec_test::fake_density_matrix(basis.size(), 0.9);
+        const auto expected = elec::fock_matrix(density_mtx, fitted, core_hamiltonian_mtx);
+
+        const auto size = static_cast<Eigen::Index>(basis.size());
+        auto fock_mtx = Eigen::MatrixXd {size, size};
+        auto electron_electron_mtx = Eigen::MatrixXd {size, size};
+        elec::fock_matrix(fock_mtx, electron_electron_mtx, density_mtx, fitted, core_hamiltonian_mtx);
+
+        REQUIRE(fock_mtx == expected);
+    }
+
+    SECTION("throws if the density matrix has the wrong size")
+    {
+        const auto wrong_density_mtx = elec_test::fake_density_matrix(basis.size() + 1, 0.2);
+        REQUIRE_THROWS_AS(fitted.coulomb_matrix(wrong_density_mtx), std::runtime_error);
+        REQUIRE_THROWS_AS(fitted.exchange_matrix(wrong_density_mtx), std::runtime_error);
+    }
+}
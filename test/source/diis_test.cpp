@@ -0,0 +1,272 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/two_electron_integral_grid.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/restricted_hartree_fock/diis.hpp"
+#include "elecstruct/restricted_hartree_fock/step.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+/*
+    A symmetric matrix with no particular structure, to stand in for a Fock or error matrix.
+*/
+auto fake_symmetric_matrix(std::size_t size, double phase) -> Eigen::MatrixXd
+{
+    const auto size_eig = static_cast<Eigen::Index>(size);
+    auto output = Eigen::MatrixXd {size_eig, size_eig};
+
+    for (Eigen::Index i0 {0}; i0 < size_eig; ++i0) {
+        for (Eigen::Index i1 {0}; i1 < size_eig; ++i1) {
+            const auto x0 = static_cast<double>(i0);
+            const auto x1 = static_cast<double>(i1);
+            output(i0, i1) = std::cos(x0 + 2.0 * x1 + phase) + std::cos(x1 + 2.0 * x0 + phase);
+        }
+    }
+
+    return output;
+}
+
+struct ScfResult
+{
+    std::size_t n_iterations;
+    double energy;
+};
+
+/*
+    A bare-bones version of the iterations in the restricted Hartree-Fock driver, for the water
+    molecule, starting from the core Hamiltonian guess.
+*/
+auto water_scf(std::size_t diis_history_length) -> ScfResult
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+
+    const auto overlap_mtx = elec::overlap_matrix(shell_pairs);
+    const auto transformation_mtx = elec::transformation_matrix(overlap_mtx);
+    auto core_hamiltonian_mtx = elec::kinetic_matrix(shell_pairs);
+    for (const auto& atom : atoms) {
+        core_hamiltonian_mtx += elec::nuclear_electron_matrix(shell_pairs, atom);
+    }
+
+    const auto grid = elec::two_electron_integral_grid(shell_pairs);
+    const auto n_electrons = std::size_t {10};
+    const auto n_max_iter = std::size_t {100};
+
+    auto diis = elec::DiisExtrapolator {std::max(diis_history_length, std::size_t {1})};
+
+    auto prev_density_mtx = elec::new_density_matrix(core_hamiltonian_mtx, transformation_mtx, n_electrons);
+    for (std::size_t i_iter {1}; i_iter <= n_max_iter; ++i_iter) {
+        const auto fock_mtx = elec::fock_matrix(prev_density_mtx, basis, grid, core_hamiltonian_mtx);
+
+        auto next_fock_mtx = fock_mtx;
+        if (diis_history_length > 0) {
+            diis.push(fock_mtx, elec::diis_error_matrix(fock_mtx, prev_density_mtx, overlap_mtx));
+            next_fock_mtx = diis.extrapolate();
+        }
+
+        const auto density_mtx = elec::new_density_matrix(next_fock_mtx, transformation_mtx, n_electrons);
+        if (elec::density_matrix_difference(prev_density_mtx, density_mtx) < 1.0e-10) {
+            return {i_iter, elec::total_energy(density_mtx, fock_mtx, core_hamiltonian_mtx, atoms)};
+        }
+
+        prev_density_mtx = density_mtx;
+    }
+
+    throw std::runtime_error {"The water SCF calculation failed to converge."};
+}
+
+}  // anonymous namespace
+
+TEST_CASE("DIIS error matrix")
+{
+    const auto size = std::size_t {4};
+    const auto size_eig = static_cast<Eigen::Index>(size);
+    const auto identity = Eigen::MatrixXd::Identity(size_eig, size_eig).eval();
+
+    SECTION("vanishes for a density matrix built from the Fock matrix")
+    {
+        const auto fock_mtx = fake_symmetric_matrix(size, 0.3);
+        const auto density_mtx = elec::new_density_matrix(fock_mtx, identity, 4);
+
+        const auto error_mtx = elec::diis_error_matrix(fock_mtx, density_mtx, identity);
+
+        REQUIRE(error_mtx.cwiseAbs().maxCoeff() < 1.0e-12);
+    }
+
+    SECTION("is antisymmetric and nonzero for a density matrix built from another Fock matrix")
+    {
+        const auto fock_mtx = fake_symmetric_matrix(size, 0.3);
+        const auto density_mtx = elec::new_density_matrix(fake_symmetric_matrix(size, 1.1), identity, 4);
+
+        const auto error_mtx = elec::diis_error_matrix(fock_mtx, density_mtx, identity);
+
+        REQUIRE(error_mtx.cwiseAbs().maxCoeff() > 1.0e-6);
+        REQUIRE(error_mtx.isApprox(-error_mtx.transpose(), 1.0e-12));
+    }
+
+    SECTION("the in-place version gives the same matrix")
+    {
+        const auto fock_mtx = fake_symmetric_matrix(size, 0.3);
+        const auto density_mtx = fake_symmetric_matrix(size, 1.1);
+        const auto overlap_mtx = fake_symmetric_matrix(size, 2.3);
+
+        auto error_mtx = Eigen::MatrixXd {size_eig, size_eig};
+        auto fock_density_mtx = Eigen::MatrixXd {size_eig, size_eig};
+        elec::diis_error_matrix(error_mtx, fock_density_mtx, fock_mtx, density_mtx, overlap_mtx);
+
+        REQUIRE(error_mtx == elec::diis_error_matrix(fock_mtx, density_mtx, overlap_mtx));
+
+        auto too_small = Eigen::MatrixXd {size_eig - 1, size_eig - 1};
+        REQUIRE_THROWS_AS(
+            elec::diis_error_matrix(too_small, fock_density_mtx, fock_mtx, density_mtx, overlap_mtx),
+            std::runtime_error
+        );
+    }
+}
+
+TEST_CASE("DIIS extrapolation")
+{
+    const auto size = std::size_t {5};
+
+    SECTION("a single Fock matrix is returned as-is")
+    {
+        auto diis = elec::DiisExtrapolator {4};
+        const auto fock_mtx = fake_symmetric_matrix(size, 0.2);
+        diis.push(fock_mtx, fake_symmetric_matrix(size, 0.7));
+
+        REQUIRE(diis.n_stored() == 1);
+        REQUIRE(diis.extrapolate().isApprox(fock_mtx, 1.0e-12));
+    }
+
+    SECTION("two opposite errors are averaged away")
+    {
+        auto diis = elec::DiisExtrapolator {4};
+        const auto fock_mtx0 = fake_symmetric_matrix(size, 0.2);
+        const auto fock_mtx1 = fake_symmetric_matrix(size, 0.5);
+        const auto error_mtx = fake_symmetric_matrix(size, 0.7);
+
+        diis.push(fock_mtx0, error_mtx);
+        diis.push(fock_mtx1, -error_mtx);
+
+        const auto coefficients = diis.coefficients();
+        REQUIRE_THAT(coefficients(0), Catch::Matchers::WithinAbs(0.5, 1.0e-12));
+        REQUIRE_THAT(coefficients(1), Catch::Matchers::WithinAbs(0.5, 1.0e-12));
+        REQUIRE(diis.extrapolate().isApprox(0.5 * (fock_mtx0 + fock_mtx1), 1.0e-12));
+    }
+
+    SECTION("the coefficients add up to one")
+    {
+        auto diis = elec::DiisExtrapolator {6};
+        for (std::size_t i {0}; i < 4; ++i) {
+            const auto phase = 0.4 * static_cast<double>(i);
+            diis.push(fake_symmetric_matrix(size, phase), std::pow(0.5, i) * fake_symmetric_matrix(size, phase + 0.1));
+        }
+
+        REQUIRE_THAT(diis.coefficients().sum(), Catch::Matchers::WithinAbs(1.0, 1.0e-12));
+    }
+
+    SECTION("only the most recent Fock matrices are kept")
+    {
+        const auto history_length = GENERATE(std::size_t {1}, std::size_t {2}, std::size_t {3});
+
+        auto diis = elec::DiisExtrapolator {history_length};
+        auto fresh = elec::DiisExtrapolator {history_length};
+
+        const auto n_pushed = std::size_t {6};
+        for (std::size_t i {0}; i < n_pushed; ++i) {
+            const auto phase = 0.3 * static_cast<double>(i);
+            const auto fock_mtx = fake_symmetric_matrix(size, phase);
+            const auto error_mtx = fake_symmetric_matrix(size, 1.0 + phase);
+
+            diis.push(fock_mtx, error_mtx);
+            if (i + history_length >= n_pushed) {
+                fresh.push(fock_mtx, error_mtx);
+            }
+        }
+
+        REQUIRE(diis.n_stored() == history_length);
+        REQUIRE(diis.extrapolate().isApprox(fresh.extrapolate(), 1.0e-10));
+    }
+
+    SECTION("the matrices are copied into the same slots, and are kept from the oldest to the most recent")
+    {
+        const auto history_length = std::size_t {3};
+        auto diis = elec::DiisExtrapolator {history_length};
+
+        auto slot_data = std::vector<const double*> {};
+        for (std::size_t i {0}; i < 7; ++i) {
+            const auto phase = 0.3 * static_cast<double>(i);
+            diis.push(fake_symmetric_matrix(size, phase), fake_symmetric_matrix(size, 1.0 + phase));
+
+            if (i + 1 == history_length) {
+                for (std::size_t i_stored {0}; i_stored < history_length; ++i_stored) {
+                    slot_data.push_back(diis.fock_matrix(i_stored).data());
+                }
+            }
+        }
+
+        // the last three pushes were i = 4, 5, 6, which went into the slots of i = 1, 2, 0
+        REQUIRE(diis.fock_matrix(0).data() == slot_data[1]);
+        REQUIRE(diis.fock_matrix(1).data() == slot_data[2]);
+        REQUIRE(diis.fock_matrix(2).data() == slot_data[0]);
+
+        for (std::size_t i_stored {0}; i_stored < history_length; ++i_stored) {
+            const auto phase = 0.3 * static_cast<double>(i_stored + 4);
+            REQUIRE(diis.fock_matrix(i_stored) == fake_symmetric_matrix(size, phase));
+            REQUIRE(diis.error_matrix(i_stored) == fake_symmetric_matrix(size, 1.0 + phase));
+        }
+        REQUIRE_THROWS_AS(diis.fock_matrix(history_length), std::runtime_error);
+
+        const auto size_eig = static_cast<Eigen::Index>(size);
+        auto extrapolated_fock_mtx = Eigen::MatrixXd {size_eig, size_eig};
+        diis.extrapolate(extrapolated_fock_mtx);
+        REQUIRE(extrapolated_fock_mtx == diis.extrapolate());
+    }
+
+    SECTION("matrices of a different size than the ones pushed before throw")
+    {
+        auto diis = elec::DiisExtrapolator {4};
+        diis.push(fake_symmetric_matrix(size, 0.2), fake_symmetric_matrix(size, 0.7));
+
+        REQUIRE_THROWS_AS(
+            diis.push(fake_symmetric_matrix(size + 1, 0.2), fake_symmetric_matrix(size + 1, 0.7)), std::runtime_error
+        );
+        REQUIRE_THROWS_AS(
+            diis.push(fake_symmetric_matrix(size, 0.2), fake_symmetric_matrix(size + 1, 0.7)), std::runtime_error
+        );
+    }
+
+    SECTION("throws for an empty history")
+    {
+        REQUIRE_THROWS_AS(elec::DiisExtrapolator {0}, std::runtime_error);
+
+        const auto diis = elec::DiisExtrapolator {4};
+        REQUIRE_THROWS_AS(diis.extrapolate(), std::runtime_error);
+        REQUIRE_THROWS_AS(diis.max_error(), std::runtime_error);
+    }
+}
+
+TEST_CASE("DIIS converges the water SCF calculation in fewer iterations")
+{
+    const auto without_diis = water_scf(0);
+    const auto with_diis = water_scf(elec::DEFAULT_DIIS_HISTORY_LENGTH);
+
+    REQUIRE_THAT(with_diis.energy, Catch::Matchers::WithinAbs(without_diis.energy, 1.0e-9));
+    REQUIRE(with_diis.n_iterations < without_diis.n_iterations);
+}
@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/restricted_hartree_fock/direct_scf.hpp"
+
+#include "test_fixtures.hpp"
+
+TEST_CASE("direct two-electron matrix")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto no_screening = elec::SchwarzScreening {shell_pairs, 0.0};
+
+    SECTION("matches the matrix built from the stored integrals")
+    {
+        const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.3);
+
+        const auto grid = elec::two_electron_integral_grid(shell_pairs);
+        const auto expected = elec::electron_electron_matrix(basis, density_mtx, grid);
+        const auto [actual, n_skipped] = elec::electron_electron_matrix_direct(shell_pairs, no_screening, density_mtx);
+
+        REQUIRE(n_skipped == 0);
+        REQUIRE(actual.isApprox(expected, 1.0e-12));
+    }
+
+    SECTION("the in-place version gives the same matrix")
+    {
+        const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.3);
+        const auto [expected, expected_n_skipped] =
+            elec::electron_electron_matrix_direct(shell_pairs, no_screening, density_mtx);
+
+        const auto size = static_cast<Eigen::Index>(basis.size());
+        auto actual = Eigen::MatrixXd {size, size};
+        const auto n_skipped = elec::electron_electron_matrix_direct(actual, shell_pairs, no_screening, density_mtx);
+
+        REQUIRE(n_skipped == expected_n_skipped);
+        REQUIRE(actual == expected);
+        REQUIRE(actual == actual.transpose());
+    }
+
+    SECTION("the incremental builds match a full build of the latest density matrix")
+    {
+        const auto full_rebuild_period = GENERATE(std::size_t {1}, std::size_t {2}, std::size_t {10});
+        auto incremental = elec::IncrementalElectronElectronMatrix {
+            shell_pairs, no_screening, elec::DEFAULT_ELECTRON_ELECTRON_ENGINE, full_rebuild_period
+        };
+
+        for (std::size_t i {0}; i < 4; ++i) {
+            const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.1 * static_cast<double>(i));
+
+            const auto& actual = incremental.update(density_mtx);
+            const auto [expected, n_skipped] =
+                elec::electron_electron_matrix_direct(shell_pairs, no_screening, density_mtx);
+
+            REQUIRE(incremental.was_full_rebuild() == (i % full_rebuild_period == 0));
+            REQUIRE(actual.isApprox(expected, 1.0e-12));
+        }
+    }
+
+    SECTION("a tiny change in the density matrix skips every quartet")
+    {
+        const auto screening = elec::SchwarzScreening {shell_pairs, 1.0e-12};
+        auto incremental = elec::IncrementalElectronElectronMatrix {
+            shell_pairs, screening, elec::DEFAULT_ELECTRON_ELECTRON_ENGINE, 10
+        };
+
+        const auto density_mtx = elec_test::fake_density_matrix(basis.size(), 0.3);
+        const auto first = incremental.update(density_mtx).eval();
+        REQUIRE(incremental.n_skipped() < elec::n_unique_quartets(basis.size()));
+
+        const auto nudged_density_mtx = (density_mtx * (1.0 + 1.0e-15)).eval();
+        const auto& second = incremental.update(nudged_density_mtx);
+
+        REQUIRE(incremental.n_skipped() == elec::n_unique_quartets(basis.size()));
+        REQUIRE(second == first);
+    }
+
+    SECTION("a full rebuild period of zero throws")
+    {
+        REQUIRE_THROWS_AS(
+            elec::IncrementalElectronElectronMatrix(shell_pairs, no_screening, elec::DEFAULT_ELECTRON_ELECTRON_ENGINE, 0),
+            std::runtime_error
+        );
+    }
+}
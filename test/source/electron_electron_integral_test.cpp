@@ -1,14 +1,25 @@
+#include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include "elecstruct/atoms.hpp"
 #include "elecstruct/basis/basis.hpp"
 #include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
 #include "elecstruct/matrices.hpp"
 #include "elecstruct/orbitals.hpp"
 
+#include "test_fixtures.hpp"
+
 auto get_h2_basis() -> std::vector<elec::AtomicOrbitalInfoSTO3G>
 {
     using AOL = elec::AtomicOrbitalLabel;
@@ -27,6 +38,23 @@ auto get_h2_basis() -> std::vector<elec::AtomicOrbitalInfoSTO3G>
     return basis;
 }
 
+/*
+    A water molecule that has been stretched apart, so that some of the two-electron integrals
+    between distant orbitals become very small.
+*/
+auto get_stretched_h2o_basis() -> std::vector<elec::AtomicOrbitalInfoSTO3G>
+{
+    using AOL = elec::AtomicOrbitalLabel;
+
+    const auto atoms = std::vector<elec::AtomInfo> {
+        elec::AtomInfo {elec::AtomLabel::O, coord::Cartesian3D {0.0, 0.0, 0.0},   {AOL::S1, AOL::S2, AOL::P2}},
+        elec::AtomInfo {elec::AtomLabel::H, coord::Cartesian3D {0.0, 6.0, -4.0},  {AOL::S1}                  },
+        elec::AtomInfo {elec::AtomLabel::H, coord::Cartesian3D {0.0, -6.0, -4.0}, {AOL::S1}                  }
+    };
+
+    return elec::create_atomic_orbitals_sto3g(atoms);
+}
+
 TEST_CASE("h2 two-electron integrals")
 {
     /*
@@ -80,3 +108,105 @@ TEST_CASE("h2 two-electron integrals")
     REQUIRE_THAT(ee_grid.get(1, 1, 1, 0), Catch::Matchers::WithinAbs(elem_1_1_1_0, abs_tolerance));
     REQUIRE_THAT(ee_grid.get(1, 1, 1, 1), Catch::Matchers::WithinAbs(elem_1_1_1_1, abs_tolerance));
 }
+
+TEST_CASE("schwarz screening")
+{
+    const auto basis = get_stretched_h2o_basis();
+    const auto ee_grid = elec::two_electron_integral_grid(basis);
+
+    SECTION("the bound is never smaller than the integral")
+    {
+        const auto screening = elec::SchwarzScreening {basis, 0.0};
+
+        for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {basis.size()}) {
+            const auto integral = std::fabs(ee_grid.get(i0, i1, i2, i3));
+            REQUIRE(integral <= screening.bound(i0, i1, i2, i3) * (1.0 + 1.0e-10));
+        }
+    }
+
+    SECTION("zero tolerance skips nothing")
+    {
+        const auto screening = elec::SchwarzScreening {basis, 0.0};
+        const auto [screened_grid, n_skipped] = elec::screened_two_electron_integral_grid(basis, screening);
+
+        REQUIRE(n_skipped == 0);
+        for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {basis.size()}) {
+            const auto expected = ee_grid.get(i0, i1, i2, i3);
+            REQUIRE_THAT(screened_grid.get(i0, i1, i2, i3), Catch::Matchers::WithinAbs(expected, 1.0e-14));
+        }
+    }
+
+    SECTION("skipped integrals are within the tolerance of the exact integrals")
+    {
+        const auto tolerance = double {1.0e-6};
+        const auto screening = elec::SchwarzScreening {basis, tolerance};
+        const auto [screened_grid, n_skipped] = elec::screened_two_electron_integral_grid(basis, screening);
+
+        REQUIRE(n_skipped > 0);
+        for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {basis.size()}) {
+            const auto expected = ee_grid.get(i0, i1, i2, i3);
+            REQUIRE_THAT(screened_grid.get(i0, i1, i2, i3), Catch::Matchers::WithinAbs(expected, tolerance));
+        }
+    }
+
+    SECTION("multithreaded grid is identical to the single-threaded grid")
+    {
+        const auto n_threads = GENERATE(std::size_t {1}, std::size_t {2}, std::size_t {4}, std::size_t {7});
+
+        const auto screening = elec::SchwarzScreening {basis, 1.0e-6};
+        const auto [serial_grid, serial_n_skipped] = elec::screened_two_electron_integral_grid(basis, screening);
+        const auto [parallel_grid, parallel_n_skipped] =
+            elec::screened_two_electron_integral_grid(basis, screening, n_threads);
+
+        REQUIRE(serial_n_skipped == parallel_n_skipped);
+        REQUIRE(serial_grid.size() == parallel_grid.size());
+
+        const auto serial_values = serial_grid.values();
+        const auto parallel_values = parallel_grid.values();
+        REQUIRE(std::memcmp(serial_values.data(), parallel_values.data(), serial_values.size_bytes()) == 0);
+    }
+}
+
+TEST_CASE("alternative engines match the cook engine")
+{
+    using EEE = elec::ElectronElectronEngine;
+
+    constexpr auto abs_tolerance = double {1.0e-10};
+
+    const auto engine = GENERATE(EEE::HEAD_GORDON_POPLE, EEE::RYS, EEE::SPECIALIZED);
+
+    SECTION("every ordering of the orbitals in the quartet")
+    {
+        const auto basis = elec_test::get_h2o_basis();
+        const auto size = basis.size();
+
+        for (std::size_t i0 {0}; i0 < size; ++i0)
+        for (std::size_t i1 {0}; i1 < size; ++i1) {
+            const auto bra = elec::make_shell_pair(basis[i0], basis[i1]);
+
+            for (std::size_t i2 {0}; i2 < size; ++i2)
+            for (std::size_t i3 {0}; i3 < size; ++i3) {
+                const auto ket = elec::make_shell_pair(basis[i2], basis[i3]);
+
+                const auto expected = elec::electron_electron_integral(bra, ket, EEE::COOK);
+                const auto actual = elec::electron_electron_integral(bra, ket, engine);
+
+                REQUIRE_THAT(actual, Catch::Matchers::WithinAbs(expected, abs_tolerance));
+            }
+        }
+    }
+
+    SECTION("the full grid of a stretched molecule")
+    {
+        const auto basis = get_stretched_h2o_basis();
+        const auto shell_pairs = elec::ShellPairData {basis};
+
+        const auto cook_grid = elec::two_electron_integral_grid(shell_pairs, EEE::COOK);
+        const auto other_grid = elec::two_electron_integral_grid(shell_pairs, engine);
+
+        for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {basis.size()}) {
+            const auto expected = cook_grid.get(i0, i1, i2, i3);
+            REQUIRE_THAT(other_grid.get(i0, i1, i2, i3), Catch::Matchers::WithinAbs(expected, abs_tolerance));
+        }
+    }
+}
@@ -0,0 +1,173 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/restricted_hartree_fock/initial_density_matrix.hpp"
+#include "elecstruct/restricted_hartree_fock/step.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+/*
+    The number of electrons held by a density matrix, tr(DS).
+*/
+auto n_electrons_in(const Eigen::MatrixXd& density_mtx, const Eigen::MatrixXd& overlap_mtx) -> double
+{
+    return (density_mtx * overlap_mtx).trace();
+}
+
+struct ScfResult
+{
+    std::size_t n_iterations;
+    double energy;
+};
+
+/*
+    Plain Roothaan iterations for the water molecule, starting from the given density matrix.
+*/
+auto water_scf(const Eigen::MatrixXd& initial_density_mtx) -> ScfResult
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+
+    const auto overlap_mtx = elec::overlap_matrix(shell_pairs);
+    const auto transformation_mtx = elec::transformation_matrix(overlap_mtx);
+    auto core_hamiltonian_mtx = elec::kinetic_matrix(shell_pairs);
+    for (const auto& atom : atoms) {
+        core_hamiltonian_mtx += elec::nuclear_electron_matrix(shell_pairs, atom);
+    }
+
+    const auto grid = elec::two_electron_integral_grid(shell_pairs);
+    const auto n_electrons = std::size_t {10};
+
+    auto prev_density_mtx = initial_density_mtx;
+    for (std::size_t i_iter {1}; i_iter <= 100; ++i_iter) {
+        const auto fock_mtx = elec::fock_matrix(prev_density_mtx, basis, grid, core_hamiltonian_mtx);
+        const auto density_mtx = elec::new_density_matrix(fock_mtx, transformation_mtx, n_electrons);
+
+        if (elec::density_matrix_difference(prev_density_mtx, density_mtx) < 1.0e-10) {
+            return {i_iter, elec::total_energy(density_mtx, fock_mtx, core_hamiltonian_mtx, atoms)};
+        }
+
+        prev_density_mtx = density_mtx;
+    }
+
+    throw std::runtime_error {"The water SCF calculation failed to converge."};
+}
+
+}  // anonymous namespace
+
+TEST_CASE("atomic density matrix")
+{
+    using AOL = elec::AtomicOrbitalLabel;
+
+    struct TestCase
+    {
+        elec::AtomLabel label;
+        std::vector<AOL> orbitals;
+        std::size_t n_basis_functions;
+    };
+
+    const auto test_case = GENERATE(
+        TestCase {elec::AtomLabel::H, {AOL::S1}, 1},
+        TestCase {elec::AtomLabel::He, {AOL::S1}, 1},
+        TestCase {elec::AtomLabel::C, {AOL::S1, AOL::S2, AOL::P2}, 5},
+        TestCase {elec::AtomLabel::O, {AOL::S1, AOL::S2, AOL::P2}, 5}
+    );
+
+    const auto& density_mtx = elec::atomic_density_matrix(test_case.label, test_case.orbitals);
+
+    const auto atoms = std::vector<elec::AtomInfo> {
+        elec::AtomInfo {test_case.label, coord::Cartesian3D {0.0, 0.0, 0.0}, test_case.orbitals}
+    };
+    const auto overlap_mtx = elec::overlap_matrix(elec::create_atomic_orbitals_sto3g(atoms));
+
+    SECTION("holds the electrons of the neutral atom")
+    {
+        REQUIRE(static_cast<std::size_t>(density_mtx.rows()) == test_case.n_basis_functions);
+
+        const auto expected = elec::nuclear_charge(test_case.label);
+        REQUIRE_THAT(n_electrons_in(density_mtx, overlap_mtx), Catch::Matchers::WithinAbs(expected, 1.0e-10));
+    }
+
+    SECTION("is symmetric, and spherically averaged")
+    {
+        REQUIRE(density_mtx.isApprox(density_mtx.transpose(), 1.0e-12));
+
+        if (test_case.n_basis_functions == 5) {
+            REQUIRE_THAT(density_mtx(2, 2), Catch::Matchers::WithinAbs(density_mtx(3, 3), 1.0e-10));
+            REQUIRE_THAT(density_mtx(2, 2), Catch::Matchers::WithinAbs(density_mtx(4, 4), 1.0e-10));
+            REQUIRE_THAT(density_mtx(2, 3), Catch::Matchers::WithinAbs(0.0, 1.0e-10));
+        }
+    }
+
+    SECTION("is only calculated once")
+    {
+        const auto& again = elec::atomic_density_matrix(test_case.label, test_case.orbitals);
+        REQUIRE(&again == &density_mtx);
+    }
+}
+
+TEST_CASE("superposition of atomic densities")
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto overlap_mtx = elec::overlap_matrix(basis);
+
+    SECTION("is block-diagonal, with the atomic density matrices as its blocks")
+    {
+        const auto density_mtx = elec::superposition_of_atomic_densities(atoms, 10);
+        REQUIRE(static_cast<std::size_t>(density_mtx.rows()) == basis.size());
+
+        const auto& oxygen_mtx = elec::atomic_density_matrix(atoms[0].label, atoms[0].orbitals);
+        const auto& hydrogen_mtx = elec::atomic_density_matrix(atoms[1].label, atoms[1].orbitals);
+
+        REQUIRE(density_mtx.block(0, 0, 5, 5) == oxygen_mtx);
+        REQUIRE(density_mtx.block(5, 5, 1, 1) == hydrogen_mtx);
+        REQUIRE(density_mtx.block(6, 6, 1, 1) == hydrogen_mtx);
+        REQUIRE(density_mtx.block(0, 5, 5, 2).isZero());
+        REQUIRE(density_mtx(5, 6) == 0.0);
+    }
+
+    SECTION("holds the requested number of electrons")
+    {
+        const auto n_electrons = GENERATE(std::size_t {8}, std::size_t {10});
+        const auto density_mtx = elec::superposition_of_atomic_densities(atoms, n_electrons);
+
+        const auto expected = static_cast<double>(n_electrons);
+        REQUIRE_THAT(n_electrons_in(density_mtx, overlap_mtx), Catch::Matchers::WithinAbs(expected, 1.0e-10));
+    }
+
+    SECTION("converges to the same energy as the core Hamiltonian guess, in fewer iterations")
+    {
+        const auto shell_pairs = elec::ShellPairData {basis};
+        const auto transformation_mtx = elec::transformation_matrix(overlap_mtx);
+        auto core_hamiltonian_mtx = elec::kinetic_matrix(shell_pairs);
+        for (const auto& atom : atoms) {
+            core_hamiltonian_mtx += elec::nuclear_electron_matrix(shell_pairs, atom);
+        }
+
+        const auto core_density_mtx = elec::new_density_matrix(core_hamiltonian_mtx, transformation_mtx, 10);
+        const auto sad_density_mtx = elec::superposition_of_atomic_densities(atoms, 10);
+
+        const auto from_core = water_scf(core_density_mtx);
+        const auto from_sad = water_scf(sad_density_mtx);
+
+        REQUIRE_THAT(from_sad.energy, Catch::Matchers::WithinAbs(from_core.energy, 1.0e-9));
+        REQUIRE(from_sad.n_iterations < from_core.n_iterations);
+    }
+}
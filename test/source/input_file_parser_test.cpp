@@ -122,7 +122,8 @@ TEST_CASE("parse INITIAL_FOCK_GUESS")
         const auto pair = GENERATE(
             TestPair {"zero", IFG::ZERO_MATRIX},
             TestPair {"extended_huckel", IFG::EXTENDED_HUCKEL_MATRIX},
-            TestPair {"core_hamiltonian", IFG::CORE_HAMILTONIAN_MATRIX}
+            TestPair {"core_hamiltonian", IFG::CORE_HAMILTONIAN_MATRIX},
+            TestPair {"superposition_of_atomic_densities", IFG::SUPERPOSITION_OF_ATOMIC_DENSITIES}
         );
 
         auto input_stream = std::stringstream {};
@@ -360,3 +361,463 @@ TEST_CASE("parse VERBOSE")
         REQUIRE_THROWS_AS(parser.parse(elec::InputFileKey::VERBOSE), std::runtime_error);
     }
 }
+
+TEST_CASE("parse SCHWARZ_SCREENING_TOLERANCE")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "schwarz_screening_tolerance = 1.0e-10\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::SCHWARZ_SCREENING_TOLERANCE);
+
+        const auto& info = parser.parsed_information();
+        const auto tolerance = info.schwarz_screening_tolerance();
+
+        REQUIRE_THAT(tolerance, Catch::Matchers::WithinRel(1.0e-10));
+    }
+
+    SECTION("zero argument disables screening")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "schwarz_screening_tolerance = 0.0\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::SCHWARZ_SCREENING_TOLERANCE);
+
+        const auto& info = parser.parsed_information();
+        const auto tolerance = info.schwarz_screening_tolerance();
+
+        REQUIRE_THAT(tolerance, Catch::Matchers::WithinAbs(0.0, 1.0e-16));
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::SCHWARZ_SCREENING_TOLERANCE);
+
+        const auto& info = parser.parsed_information();
+        const auto tolerance = info.schwarz_screening_tolerance();
+
+        REQUIRE_THAT(tolerance, Catch::Matchers::WithinRel(elec::DEFAULT_SCHWARZ_SCREENING_TOLERANCE));
+    }
+
+    SECTION("negative argument")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "schwarz_screening_tolerance = -1.0e-10\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::SCHWARZ_SCREENING_TOLERANCE), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse N_THREADS")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "n_threads = 4\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::N_THREADS);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.n_threads() == 4);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::N_THREADS);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.n_threads() == elec::DEFAULT_N_THREADS);
+    }
+
+    SECTION("invalid argument")
+    {
+        const auto line = GENERATE("n_threads = 0\n", "n_threads = -2\n", "n_threads = 2.5\n");
+
+        auto input_stream = std::stringstream {};
+        input_stream << line;
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::N_THREADS), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse ELECTRON_ELECTRON_ENGINE")
+{
+    using IFG = elec::InputFileKey;
+    using EEE = elec::ElectronElectronEngine;
+
+    SECTION("valid input")
+    {
+        struct TestPair
+        {
+            std::string input;
+            EEE expected;
+        };
+
+        const auto pair = GENERATE(
+            TestPair {"cook", EEE::COOK},
+            TestPair {"head_gordon_pople", EEE::HEAD_GORDON_POPLE},
+            TestPair {"rys", EEE::RYS},
+            TestPair {"specialized", EEE::SPECIALIZED}
+        );
+
+        auto input_stream = std::stringstream {};
+        input_stream << "electron_electron_engine = "
+                     << "\"" << pair.input << "\"" << '\n';
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::ELECTRON_ELECTRON_ENGINE);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.electron_electron_engine() == pair.expected);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::ELECTRON_ELECTRON_ENGINE);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.electron_electron_engine() == elec::DEFAULT_ELECTRON_ELECTRON_ENGINE);
+    }
+
+    SECTION("invalid throws")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << R"(electron_electron_engine = "invalid_type"\n)";
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::ELECTRON_ELECTRON_ENGINE), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse SCF_MODE")
+{
+    using IFG = elec::InputFileKey;
+    using SM = elec::ScfMode;
+
+    SECTION("valid input")
+    {
+        struct TestPair
+        {
+            std::string input;
+            SM expected;
+        };
+
+        const auto pair = GENERATE(
+            TestPair {"conventional", SM::CONVENTIONAL},
+            TestPair {"direct", SM::DIRECT},
+            TestPair {"out_of_core", SM::OUT_OF_CORE},
+            TestPair {"density_fitting", SM::DENSITY_FITTING},
+            TestPair {"cholesky", SM::CHOLESKY}
+        );
+
+        auto input_stream = std::stringstream {};
+        input_stream << "scf_mode = "
+                     << "\"" << pair.input << "\"" << '\n';
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::SCF_MODE);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.scf_mode() == pair.expected);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::SCF_MODE);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.scf_mode() == elec::DEFAULT_SCF_MODE);
+    }
+
+    SECTION("invalid throws")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << R"(scf_mode = "invalid_type"\n)";
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::SCF_MODE), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse CHOLESKY_THRESHOLD")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "cholesky_threshold = 1.0e-8\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::CHOLESKY_THRESHOLD);
+
+        const auto& info = parser.parsed_information();
+        const auto threshold = info.cholesky_threshold();
+
+        REQUIRE_THAT(threshold, Catch::Matchers::WithinRel(1.0e-8));
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::CHOLESKY_THRESHOLD);
+
+        const auto& info = parser.parsed_information();
+        const auto threshold = info.cholesky_threshold();
+
+        REQUIRE_THAT(threshold, Catch::Matchers::WithinRel(elec::DEFAULT_CHOLESKY_THRESHOLD));
+    }
+
+    SECTION("negative argument")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "cholesky_threshold = -1.0e-8\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::CHOLESKY_THRESHOLD), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse DIIS_START_ITERATION")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "diis_start_iteration = 3\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::DIIS_START_ITERATION);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.diis_start_iteration() == 3);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::DIIS_START_ITERATION);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.diis_start_iteration() == elec::DEFAULT_DIIS_START_ITERATION);
+    }
+
+    SECTION("invalid argument")
+    {
+        const auto line = GENERATE("diis_start_iteration = 0\n", "diis_start_iteration = -1\n");
+
+        auto input_stream = std::stringstream {};
+        input_stream << line;
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::DIIS_START_ITERATION), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse DIIS_HISTORY_LENGTH")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        const auto length = GENERATE(std::size_t {0}, std::size_t {6});
+
+        auto input_stream = std::stringstream {};
+        input_stream << "diis_history_length = " << length << '\n';
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::DIIS_HISTORY_LENGTH);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.diis_history_length() == length);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::DIIS_HISTORY_LENGTH);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.diis_history_length() == elec::DEFAULT_DIIS_HISTORY_LENGTH);
+    }
+
+    SECTION("invalid argument")
+    {
+        const auto line = GENERATE("diis_history_length = -1\n", "diis_history_length = 2.5\n");
+
+        auto input_stream = std::stringstream {};
+        input_stream << line;
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::DIIS_HISTORY_LENGTH), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse CHECKPOINT_FILE")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "checkpoint_file = \"water.chk\"\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::CHECKPOINT_FILE);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.checkpoint_file().has_value());
+        REQUIRE(*info.checkpoint_file() == "water.chk");
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::CHECKPOINT_FILE);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(!info.checkpoint_file().has_value());
+    }
+
+    SECTION("invalid argument")
+    {
+        const auto line = GENERATE("checkpoint_file = \"\"\n", "checkpoint_file = 5\n");
+
+        auto input_stream = std::stringstream {};
+        input_stream << line;
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::CHECKPOINT_FILE), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse CHECKPOINT_PERIOD")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        const auto period = GENERATE(std::size_t {1}, std::size_t {10});
+
+        auto input_stream = std::stringstream {};
+        input_stream << "checkpoint_period = " << period << '\n';
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::CHECKPOINT_PERIOD);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.checkpoint_period() == period);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::CHECKPOINT_PERIOD);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.checkpoint_period() == elec::DEFAULT_CHECKPOINT_PERIOD);
+    }
+
+    SECTION("invalid argument")
+    {
+        const auto line = GENERATE("checkpoint_period = 0\n", "checkpoint_period = -3\n", "checkpoint_period = 1.5\n");
+
+        auto input_stream = std::stringstream {};
+        input_stream << line;
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::CHECKPOINT_PERIOD), std::runtime_error);
+    }
+}
+
+TEST_CASE("parse RESTART_FROM_CHECKPOINT")
+{
+    using IFG = elec::InputFileKey;
+
+    SECTION("valid example")
+    {
+        const auto restart = GENERATE(true, false);
+
+        auto input_stream = std::stringstream {};
+        input_stream << "restart_from_checkpoint = " << std::boolalpha << restart << '\n';
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::RESTART_FROM_CHECKPOINT);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(info.restart_from_checkpoint() == restart);
+    }
+
+    SECTION("not there gives default")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+        parser.parse(IFG::RESTART_FROM_CHECKPOINT);
+
+        const auto& info = parser.parsed_information();
+        REQUIRE(!info.restart_from_checkpoint());
+    }
+
+    SECTION("invalid argument")
+    {
+        auto input_stream = std::stringstream {};
+        input_stream << "restart_from_checkpoint = \"yes\"\n";
+
+        auto parser = elec::InputFileParser {input_stream};
+
+        REQUIRE_THROWS_AS(parser.parse(IFG::RESTART_FROM_CHECKPOINT), std::runtime_error);
+    }
+}
@@ -3,6 +3,8 @@
 
 #include "elecstruct/cartesian3d.hpp"
 #include "elecstruct/integrals/kinetic_integrals.hpp"
+#include "elecstruct/integrals/overlap_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
 #include "elecstruct/orbitals.hpp"
 
 TEST_CASE("cyclic shifts")
@@ -51,3 +53,39 @@ TEST_CASE("cyclic shifts")
         REQUIRE_THAT(directed_right.other1, Catch::Matchers::WithinRel(positions.y, REL_TOLERANCE));
     }
 }
+
+TEST_CASE("the 1D kinetic integrals along each axis add up to the primitive kinetic integral")
+{
+    const auto angmom0 = elec::AngularMomentumNumbers {1, 0, 2};
+    const auto angmom1 = elec::AngularMomentumNumbers {0, 1, 1};
+    const auto position0 = coord::Cartesian3D {0.1, -0.4, 0.7};
+    const auto position1 = coord::Cartesian3D {-0.3, 0.5, 0.2};
+    const auto exponent0 = double {0.8};
+    const auto exponent1 = double {1.3};
+
+    const auto primitive =
+        elec::make_primitive_pair_data(angmom0, angmom1, position0, position1, {1.0, exponent0}, {1.0, exponent1});
+    const auto pair = elec::ShellPair {angmom0, angmom1, position0, position1, {primitive}};
+    const auto expected = elec::primitive_kinetic_integral(pair, primitive, elec::overlap_integrals_1d(pair, primitive));
+
+    auto angmom_a = elec::DirectedAngularMomentumNumbers {angmom0};
+    auto angmom_b = elec::DirectedAngularMomentumNumbers {angmom1};
+    auto pos_a = elec::DirectedCartesian3D {position0};
+    auto pos_b = elec::DirectedCartesian3D {position1};
+    auto pos_centre = elec::DirectedCartesian3D {primitive.product_centre};
+
+    auto actual = double {0.0};
+    for (int i {0}; i < 3; ++i) {
+        actual += elec::unnormalized_kinetic_integral_1d(
+            angmom_a, angmom_b, pos_a, pos_b, pos_centre, exponent0, exponent1, primitive.prefactor
+        );
+
+        angmom_a = elec::left_cyclic_shift(angmom_a);
+        angmom_b = elec::left_cyclic_shift(angmom_b);
+        pos_a = elec::left_cyclic_shift(pos_a);
+        pos_b = elec::left_cyclic_shift(pos_b);
+        pos_centre = elec::left_cyclic_shift(pos_centre);
+    }
+
+    REQUIRE_THAT(actual, Catch::Matchers::WithinRel(expected, 1.0e-12));
+}
@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <Eigen/Dense>
+
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/integrals/nuclear_electron_integrals.hpp"
+#include "elecstruct/integrals/one_electron_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/matrices.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+constexpr auto ABS_TOLERANCE = double {1.0e-12};
+
+/*
+    A few copies of the water molecule, spaced out along the x-axis; the basis is large enough to be
+    split across several tiles.
+*/
+auto water_cluster_atoms(std::size_t n_molecules) -> std::vector<elec::AtomInfo>
+{
+    auto atoms = std::vector<elec::AtomInfo> {};
+
+    for (std::size_t i {0}; i < n_molecules; ++i) {
+        const auto shift = coord::Cartesian3D {6.0 * static_cast<double>(i), 0.0, 0.0};
+        for (auto atom : elec_test::get_h2o_atoms()) {
+            atom.position += shift;
+            atoms.push_back(atom);
+        }
+    }
+
+    return atoms;
+}
+
+auto is_matrix_equal(const Eigen::MatrixXd& mtx0, const Eigen::MatrixXd& mtx1, double tolerance) -> bool
+{
+    if (mtx0.rows() != mtx1.rows() || mtx0.cols() != mtx1.cols()) {
+        return false;
+    }
+
+    return (mtx0 - mtx1).cwiseAbs().maxCoeff() <= tolerance;
+}
+
+}  // anonymous namespace
+
+TEST_CASE("one-electron matrices : water")
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+
+    const auto [overlap_mtx, kinetic_mtx, nuclear_electron_mtx] = elec::one_electron_matrices(shell_pairs, atoms);
+
+    SECTION("the overlap matrix matches the separate builder")
+    {
+        REQUIRE(is_matrix_equal(overlap_mtx, elec::overlap_matrix(basis), ABS_TOLERANCE));
+    }
+
+    SECTION("the kinetic matrix matches the separate builder")
+    {
+        REQUIRE(is_matrix_equal(kinetic_mtx, elec::kinetic_matrix(basis), ABS_TOLERANCE));
+    }
+
+    SECTION("the nuclear-electron matrix is the sum of the separate matrices of each atom")
+    {
+        auto expected = Eigen::MatrixXd {Eigen::MatrixXd::Zero(overlap_mtx.rows(), overlap_mtx.cols())};
+        for (const auto& atom : atoms) {
+            expected += elec::nuclear_electron_matrix(basis, atom);
+        }
+
+        REQUIRE(is_matrix_equal(nuclear_electron_mtx, expected, ABS_TOLERANCE));
+    }
+
+    SECTION("the core Hamiltonian matrix is the sum of the kinetic and nuclear-electron matrices")
+    {
+        const auto core_hamiltonian_mtx = elec::core_hamiltonian_matrix(shell_pairs, atoms);
+        REQUIRE(is_matrix_equal(core_hamiltonian_mtx, kinetic_mtx + nuclear_electron_mtx, ABS_TOLERANCE));
+    }
+}
+
+TEST_CASE("one-electron integrals : sum over nuclei")
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto nuclei = elec::point_charges(atoms);
+
+    for (std::size_t i0 {0}; i0 < basis.size(); ++i0) {
+        for (std::size_t i1 {i0}; i1 < basis.size(); ++i1) {
+            const auto& pair = shell_pairs.get(i0, i1);
+
+            auto expected = 0.0;
+            for (const auto& nucleus : nuclei) {
+                expected += elec::nuclear_electron_integral(pair, nucleus.position, nucleus.charge);
+            }
+
+            const auto integrals = elec::one_electron_integrals(pair, nuclei);
+
+            const auto summed = elec::nuclear_electron_integral(pair, nuclei);
+
+            REQUIRE_THAT(summed, Catch::Matchers::WithinAbs(expected, ABS_TOLERANCE));
+            REQUIRE_THAT(integrals.nuclear_electron, Catch::Matchers::WithinAbs(expected, ABS_TOLERANCE));
+        }
+    }
+}
+
+TEST_CASE("one-electron matrices : multithreaded")
+{
+    const auto atoms = water_cluster_atoms(5);
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+
+    REQUIRE(basis.size() > 32);
+
+    const auto expected = elec::one_electron_matrices(shell_pairs, atoms);
+
+    for (const auto n_threads : {std::size_t {1}, std::size_t {2}, std::size_t {3}, std::size_t {8}}) {
+        const auto actual = elec::one_electron_matrices(shell_pairs, atoms, n_threads);
+
+        // every element is calculated by exactly one thread, so the results are identical
+        REQUIRE(actual.overlap_mtx == expected.overlap_mtx);
+        REQUIRE(actual.kinetic_mtx == expected.kinetic_mtx);
+        REQUIRE(actual.nuclear_electron_mtx == expected.nuclear_electron_mtx);
+    }
+}
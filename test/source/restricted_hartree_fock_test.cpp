@@ -0,0 +1,120 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+#include "elecstruct/restricted_hartree_fock/restricted_hartree_fock.hpp"
+
+#include "test_fixtures.hpp"
+
+TEST_CASE("restricted Hartree-Fock result")
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto size = static_cast<Eigen::Index>(basis.size());
+
+    const auto result = elec::perform_restricted_hartree_fock(atoms, basis, elec_test::water_options());
+
+    SECTION("holds the converged energy and matrices")
+    {
+        REQUIRE(result.is_converged);
+        REQUIRE_THAT(result.total_energy, Catch::Matchers::WithinAbs(elec_test::WATER_STO3G_ENERGY, 1.0e-7));
+
+        REQUIRE(result.orbital_energies.size() == size);
+        REQUIRE(result.coefficient_mtx.rows() == size);
+        REQUIRE(result.coefficient_mtx.cols() == size);
+        REQUIRE(result.density_mtx.rows() == size);
+        REQUIRE(result.fock_mtx.rows() == size);
+    }
+
+    SECTION("the orbitals are sorted, and make up the density matrix")
+    {
+        for (Eigen::Index i {1}; i < size; ++i) {
+            REQUIRE(result.orbital_energies(i - 1) <= result.orbital_energies(i));
+        }
+
+        const auto density_mtx = elec::density_matrix_restricted_hartree_fock(result.coefficient_mtx, 10);
+        REQUIRE(density_mtx.isApprox(result.density_mtx, 1.0e-6));
+
+        const auto overlap_mtx = elec::overlap_matrix(basis);
+        REQUIRE_THAT((result.density_mtx * overlap_mtx).trace(), Catch::Matchers::WithinAbs(10.0, 1.0e-8));
+    }
+
+    SECTION("the history has one entry per iteration")
+    {
+        REQUIRE(result.history.size() == result.n_iterations);
+        for (std::size_t i {0}; i < result.history.size(); ++i) {
+            REQUIRE(result.history[i].iteration == i + 1);
+            REQUIRE(result.history[i].seconds >= 0.0);
+        }
+
+        REQUIRE(result.history.back().density_matrix_difference < 1.0e-8);
+        REQUIRE(result.history.back().total_energy == result.total_energy);
+        REQUIRE(result.setup_seconds <= result.total_seconds);
+    }
+
+    SECTION("a warm start from the converged density matrix converges right away")
+    {
+        auto options = elec_test::water_options();
+        options.initial_density_mtx = result.density_mtx;
+
+        const auto restarted = elec::perform_restricted_hartree_fock(atoms, basis, options);
+
+        REQUIRE(restarted.is_converged);
+        REQUIRE(restarted.n_iterations <= 2);
+        REQUIRE_THAT(restarted.total_energy, Catch::Matchers::WithinAbs(result.total_energy, 1.0e-8));
+    }
+
+    SECTION("a warm start from the converged coefficient matrix converges right away")
+    {
+        auto options = elec_test::water_options();
+        options.initial_coefficient_mtx = result.coefficient_mtx;
+
+        const auto restarted = elec::perform_restricted_hartree_fock(atoms, basis, options);
+
+        REQUIRE(restarted.is_converged);
+        REQUIRE(restarted.n_iterations <= 2);
+        REQUIRE_THAT(restarted.total_energy, Catch::Matchers::WithinAbs(result.total_energy, 1.0e-8));
+    }
+
+    SECTION("a calculation that runs out of iterations is not converged")
+    {
+        auto options = elec_test::water_options();
+        options.n_max_iter = 2;
+
+        const auto unfinished = elec::perform_restricted_hartree_fock(atoms, basis, options);
+
+        REQUIRE(!unfinished.is_converged);
+        REQUIRE(unfinished.n_iterations == 2);
+        REQUIRE(unfinished.history.size() == 2);
+    }
+
+    SECTION("the period of the direct SCF rebuilds only matters to a direct calculation")
+    {
+        auto options = elec_test::water_options();
+        options.direct_scf_full_rebuild_period = 0;
+
+        const auto conventional = elec::perform_restricted_hartree_fock(atoms, basis, options);
+        REQUIRE(conventional.is_converged);
+
+        options.scf_mode = elec::ScfMode::DIRECT;
+        REQUIRE_THROWS_AS(elec::perform_restricted_hartree_fock(atoms, basis, options), std::runtime_error);
+    }
+
+    SECTION("throws for a warm start that does not match the basis")
+    {
+        auto options = elec_test::water_options();
+        options.initial_density_mtx = Eigen::MatrixXd::Zero(size + 1, size + 1);
+        REQUIRE_THROWS_AS(elec::perform_restricted_hartree_fock(atoms, basis, options), std::runtime_error);
+
+        options.initial_coefficient_mtx = result.coefficient_mtx;
+        REQUIRE_THROWS_AS(elec::perform_restricted_hartree_fock(atoms, basis, options), std::runtime_error);
+    }
+}
@@ -1,11 +1,19 @@
+#include <stdexcept>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
 #include <Eigen/Dense>
 
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/matrices.hpp"
 #include "elecstruct/restricted_hartree_fock/step.hpp"
 
+#include "test_fixtures.hpp"
+
 constexpr auto ABS_TOLERANCE = double {1.0e-6};
 
 TEST_CASE("sorted_indices")
@@ -38,3 +46,104 @@ TEST_CASE("matrix_with_sorted_columns")
     REQUIRE_THAT(output(1, 2), Catch::Matchers::WithinAbs(1.0, ABS_TOLERANCE));
     REQUIRE_THAT(output(2, 2), Catch::Matchers::WithinAbs(2.0, ABS_TOLERANCE));
 }
+
+TEST_CASE("scf workspace")
+{
+    const auto atoms = elec_test::get_h2o_atoms();
+    const auto n_electrons = std::size_t {10};
+
+    const auto basis = elec::create_atomic_orbitals_sto3g(atoms);
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto [overlap_mtx, kinetic_mtx, nuclear_mtx] = elec::one_electron_matrices(shell_pairs, atoms);
+    const auto core_hamiltonian_mtx = (kinetic_mtx + nuclear_mtx).eval();
+    const auto transformation_mtx = elec::transformation_matrix(overlap_mtx);
+    const auto two_electron_integrals = elec::two_electron_integral_grid(shell_pairs);
+
+    auto workspace = elec::ScfWorkspace {basis.size()};
+    REQUIRE(workspace.n_basis_functions() == basis.size());
+
+    SECTION("the in-place steps give the same matrices as the steps that return new ones")
+    {
+        const auto expected_orbitals = elec::molecular_orbitals(core_hamiltonian_mtx, transformation_mtx);
+        const auto expected_density_mtx =
+            elec::new_density_matrix(core_hamiltonian_mtx, transformation_mtx, n_electrons);
+
+        elec::new_density_matrix(core_hamiltonian_mtx, transformation_mtx, n_electrons, workspace);
+
+        REQUIRE(workspace.orbital_energies == expected_orbitals.energies);
+        REQUIRE(workspace.coefficient_mtx == expected_orbitals.coefficient_mtx);
+        REQUIRE(workspace.density_mtx == expected_density_mtx);
+
+        const auto expected_fock_mtx =
+            elec::fock_matrix(expected_density_mtx, basis, two_electron_integrals, core_hamiltonian_mtx);
+
+        elec::fock_matrix(
+            workspace.fock_mtx,
+            workspace.electron_electron_mtx,
+            workspace.density_mtx,
+            two_electron_integrals,
+            core_hamiltonian_mtx
+        );
+
+        REQUIRE(workspace.fock_mtx == expected_fock_mtx);
+    }
+
+    SECTION("the buffers are reused, instead of reallocated")
+    {
+        const auto* density_data = workspace.density_mtx.data();
+        const auto* coefficient_data = workspace.coefficient_mtx.data();
+        const auto* fock_data = workspace.fock_mtx.data();
+
+        for (int i {0}; i < 3; ++i) {
+            elec::new_density_matrix(core_hamiltonian_mtx, transformation_mtx, n_electrons, workspace);
+            elec::fock_matrix(
+                workspace.fock_mtx,
+                workspace.electron_electron_mtx,
+                workspace.density_mtx,
+                two_electron_integrals,
+                core_hamiltonian_mtx
+            );
+        }
+
+        REQUIRE(workspace.density_mtx.data() == density_data);
+        REQUIRE(workspace.coefficient_mtx.data() == coefficient_data);
+        REQUIRE(workspace.fock_mtx.data() == fock_data);
+    }
+
+    SECTION("a Fock matrix of the wrong size throws")
+    {
+        const auto too_small = Eigen::MatrixXd {Eigen::MatrixXd::Identity(2, 2)};
+        REQUIRE_THROWS_AS(
+            elec::new_density_matrix(too_small, transformation_mtx, n_electrons, workspace),
+            std::runtime_error
+        );
+    }
+}
+
+TEST_CASE("density matrix from the occupied orbitals")
+{
+    auto coefficient_mtx = Eigen::MatrixXd {4, 4};
+    coefficient_mtx << 0.9, -0.3, 0.2, 0.1,
+                       0.2, 0.8, -0.4, 0.3,
+                       -0.1, 0.4, 0.7, -0.5,
+                       0.3, 0.1, 0.5, 0.6;
+
+    SECTION("D = 2 C_occ C_occ^T, exactly symmetric")
+    {
+        const auto density_mtx = elec::density_matrix_restricted_hartree_fock(coefficient_mtx, 4);
+        const auto c_occ = coefficient_mtx.leftCols(2);
+        const auto expected = (2.0 * c_occ * c_occ.transpose()).eval();
+
+        for (Eigen::Index i0 {0}; i0 < 4; ++i0) {
+            for (Eigen::Index i1 {0}; i1 < 4; ++i1) {
+                REQUIRE_THAT(density_mtx(i0, i1), Catch::Matchers::WithinAbs(expected(i0, i1), 1.0e-12));
+                REQUIRE(density_mtx(i0, i1) == density_mtx(i1, i0));
+            }
+        }
+    }
+
+    SECTION("more occupied orbitals than basis functions throws")
+    {
+        REQUIRE_THROWS_AS(elec::density_matrix_restricted_hartree_fock(coefficient_mtx, 10), std::runtime_error);
+    }
+}
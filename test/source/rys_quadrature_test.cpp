@@ -0,0 +1,50 @@
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/integrals/boys.hpp"
+#include "elecstruct/integrals/rys_quadrature.hpp"
+
+TEST_CASE("rys quadrature")
+{
+    SECTION("the quadrature reproduces the moments of the weight function")
+    {
+        const auto x = GENERATE(0.0, 1.0e-6, 0.1, 1.0, 4.0, 12.5, 30.0);
+        const auto n_roots = GENERATE(std::size_t {1}, std::size_t {2}, std::size_t {3}, std::size_t {4});
+
+        const auto quadrature = elec::rys_quadrature(x, n_roots);
+        REQUIRE(quadrature.n_roots == n_roots);
+
+        for (std::size_t k {0}; k < 2 * n_roots; ++k) {
+            auto moment = double {0.0};
+            for (std::size_t i {0}; i < n_roots; ++i) {
+                moment += quadrature.weights[i] * std::pow(quadrature.roots[i], static_cast<double>(k));
+            }
+
+            const auto expected = elec::boys_beylkin_sharma(x, k);
+            REQUIRE_THAT(moment, Catch::Matchers::WithinRel(expected, 1.0e-8));
+        }
+    }
+
+    SECTION("the roots lie in (0, 1) and the weights are positive")
+    {
+        const auto x = GENERATE(0.0, 0.5, 8.0, 25.0);
+        const auto quadrature = elec::rys_quadrature(x, 3);
+
+        for (std::size_t i {0}; i < quadrature.n_roots; ++i) {
+            REQUIRE(quadrature.roots[i] > 0.0);
+            REQUIRE(quadrature.roots[i] < 1.0);
+            REQUIRE(quadrature.weights[i] > 0.0);
+        }
+    }
+
+    SECTION("invalid number of roots")
+    {
+        const auto n_roots = GENERATE(std::size_t {0}, elec::RYS_MAX_N_ROOTS + 1);
+        REQUIRE_THROWS_AS(elec::rys_quadrature(1.0, n_roots), std::runtime_error);
+    }
+}
@@ -0,0 +1,78 @@
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/geometry.hpp"
+#include "elecstruct/integrals/electron_electron_integrals.hpp"
+#include "elecstruct/integrals/overlap_integrals.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/mathtools/gaussian.hpp"
+
+#include "test_fixtures.hpp"
+
+TEST_CASE("shell pair data")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto size = basis.size();
+
+    SECTION("the pairs (i0, i1) and (i1, i0) are the same object")
+    {
+        REQUIRE(shell_pairs.n_basis_functions() == size);
+
+        for (std::size_t i0 {0}; i0 < size; ++i0) {
+            for (std::size_t i1 {0}; i1 < size; ++i1) {
+                REQUIRE(&shell_pairs.get(i0, i1) == &shell_pairs.get(i1, i0));
+            }
+        }
+    }
+
+    SECTION("the primitive pair data matches the gaussian product")
+    {
+        const auto& orbital0 = basis[1];
+        const auto& orbital1 = basis[5];
+        const auto& pair = shell_pairs.get(5, 1);
+
+        REQUIRE(pair.primitives.size() == orbital0.gaussians.size() * orbital1.gaussians.size());
+
+        auto i_primitive = std::size_t {0};
+        for (const auto& gaussian1 : orbital1.gaussians) {
+            for (const auto& gaussian0 : orbital0.gaussians) {
+                const auto& primitive = pair.primitives[i_primitive];
+                const auto [centre, prefactor] = elec::math::gaussian_product(
+                    orbital1.position, orbital0.position, gaussian1.exponent_coeff, gaussian0.exponent_coeff
+                );
+
+                const auto norm0 = elec::math::gaussian_norm(orbital0.angular_momentum, gaussian0.exponent_coeff);
+                const auto norm1 = elec::math::gaussian_norm(orbital1.angular_momentum, gaussian1.exponent_coeff);
+                const auto coefficient = gaussian0.contraction_coeff * gaussian1.contraction_coeff * norm0 * norm1;
+                const auto exponent_sum = gaussian0.exponent_coeff + gaussian1.exponent_coeff;
+
+                REQUIRE_THAT(primitive.exponent_sum, Catch::Matchers::WithinRel(exponent_sum));
+                REQUIRE_THAT(primitive.prefactor, Catch::Matchers::WithinRel(prefactor));
+                REQUIRE_THAT(primitive.coefficient, Catch::Matchers::WithinRel(coefficient));
+                REQUIRE_THAT(coord::norm_squared(primitive.product_centre - centre), Catch::Matchers::WithinAbs(0.0, 1.0e-24));
+
+                ++i_primitive;
+            }
+        }
+    }
+
+    SECTION("each orbital is normalized")
+    {
+        for (std::size_t i {0}; i < size; ++i) {
+            REQUIRE_THAT(elec::overlap_integral(shell_pairs.get(i, i)), Catch::Matchers::WithinAbs(1.0, 1.0e-6));
+        }
+    }
+
+    SECTION("two-electron integrals from the shell pairs match those from the orbitals")
+    {
+        const auto integral_from_pairs = elec::electron_electron_integral(shell_pairs.get(4, 2), shell_pairs.get(6, 5));
+        const auto integral_from_orbitals = elec::electron_electron_integral(basis[4], basis[2], basis[6], basis[5]);
+
+        REQUIRE_THAT(integral_from_pairs, Catch::Matchers::WithinAbs(integral_from_orbitals, 1.0e-12));
+    }
+}
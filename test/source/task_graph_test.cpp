@@ -0,0 +1,126 @@
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "elecstruct/parallel/task_graph.hpp"
+
+TEST_CASE("task graph")
+{
+    SECTION("every task runs exactly once, after all of its dependencies")
+    {
+        const auto n_threads = GENERATE(std::size_t {1}, std::size_t {2}, std::size_t {8});
+
+        auto order_mutex = std::mutex {};
+        auto order = std::vector<std::string> {};
+        const auto record = [&](const char* name)
+        {
+            return [&order_mutex, &order, name]()
+            {
+                const auto lock = std::scoped_lock {order_mutex};
+                order.emplace_back(name);
+            };
+        };
+
+        const auto position = [&](const char* name)
+        {
+            for (std::size_t i {0}; i < order.size(); ++i) {
+                if (order[i] == name) {
+                    return i;
+                }
+            }
+
+            return order.size();
+        };
+
+        auto graph = elec::parallel::TaskGraph {};
+        const auto a = graph.add("a", record("a"));
+        const auto b = graph.add("b", record("b"), {a});
+        const auto c = graph.add("c", record("c"), {a});
+        const auto d = graph.add("d", record("d"));
+        graph.add("e", record("e"), {b, c, d});
+
+        REQUIRE(graph.size() == 5);
+
+        const auto timings = graph.run(n_threads);
+
+        REQUIRE(order.size() == 5);
+        REQUIRE(position("a") < position("b"));
+        REQUIRE(position("a") < position("c"));
+        REQUIRE(position("b") < position("e"));
+        REQUIRE(position("c") < position("e"));
+        REQUIRE(position("d") < position("e"));
+
+        REQUIRE(timings.size() == 5);
+        for (const auto* name : {"a", "b", "c", "d", "e"}) {
+            REQUIRE(timings[static_cast<std::size_t>(name[0] - 'a')].name == name);
+        }
+
+        for (const auto& timing : timings) {
+            REQUIRE(!timing.is_skipped);
+            REQUIRE(timing.start_seconds >= 0.0);
+            REQUIRE(timing.seconds >= 0.0);
+        }
+    }
+
+    SECTION("with a single thread, the ready tasks run in the order they were added")
+    {
+        auto order = std::vector<int> {};
+
+        auto graph = elec::parallel::TaskGraph {};
+        const auto first = graph.add("first", [&]() { order.push_back(0); });
+        graph.add("second", [&]() { order.push_back(1); });
+        graph.add("third", [&]() { order.push_back(2); }, {first});
+
+        graph.run(1);
+
+        REQUIRE(order == std::vector<int> {0, 1, 2});
+    }
+
+    SECTION("an empty graph is not an error")
+    {
+        auto graph = elec::parallel::TaskGraph {};
+        REQUIRE(graph.run(4).empty());
+    }
+
+    SECTION("zero threads throws")
+    {
+        auto graph = elec::parallel::TaskGraph {};
+        graph.add("task", []() {});
+
+        REQUIRE_THROWS_AS(graph.run(0), std::runtime_error);
+    }
+
+    SECTION("a task cannot depend on a task that was not added before it")
+    {
+        auto graph = elec::parallel::TaskGraph {};
+        const auto first = graph.add("first", []() {});
+
+        REQUIRE_THROWS_AS(graph.add("second", []() {}, {first + 1}), std::runtime_error);
+    }
+
+    SECTION("the dependents of a failed task are skipped, and the exception is rethrown")
+    {
+        const auto n_threads = GENERATE(std::size_t {1}, std::size_t {3});
+
+        auto n_finished = std::atomic<int> {0};
+        auto n_skipped_ran = std::atomic<int> {0};
+
+        auto graph = elec::parallel::TaskGraph {};
+        const auto failing = graph.add("failing", []() { throw std::runtime_error {"task failed"}; });
+        const auto dependent = graph.add("dependent", [&]() { ++n_skipped_ran; }, {failing});
+        graph.add("indirect_dependent", [&]() { ++n_skipped_ran; }, {dependent});
+        for (int i {0}; i < 5; ++i) {
+            graph.add("independent", [&]() { ++n_finished; });
+        }
+
+        REQUIRE_THROWS_AS(graph.run(n_threads), std::runtime_error);
+        REQUIRE(n_finished.load() == 5);
+        REQUIRE(n_skipped_ran.load() == 0);
+    }
+}
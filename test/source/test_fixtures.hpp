@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "elecstruct/atoms.hpp"
+#include "elecstruct/basis/basis.hpp"
+#include "elecstruct/cartesian3d.hpp"
+#include "elecstruct/input_file_parser/input_file_options.hpp"
+#include "elecstruct/restricted_hartree_fock/restricted_hartree_fock.hpp"
+
+/*
+    The molecules and matrices that several of the tests share.
+*/
+
+namespace elec_test
+{
+
+/*
+    The converged restricted Hartree-Fock energy of the water molecule of `get_h2o_atoms()`, in the STO-3G
+    basis, to the seven decimal places that the tests compare against.
+*/
+constexpr auto WATER_STO3G_ENERGY = double {-74.9617886};
+
+/*
+    The water molecule at its equilibrium geometry; `hydrogen_y` moves the first hydrogen atom, for the
+    tests that need a slightly different geometry.
+*/
+inline auto get_h2o_atoms(double hydrogen_y = 1.4194772) -> std::vector<elec::AtomInfo>
+{
+    using AOL = elec::AtomicOrbitalLabel;
+
+    return std::vector<elec::AtomInfo> {
+        elec::AtomInfo {elec::AtomLabel::O, coord::Cartesian3D {0.0, 0.0, 0.2198128},         {AOL::S1, AOL::S2, AOL::P2}},
+        elec::AtomInfo {elec::AtomLabel::H, coord::Cartesian3D {0.0, hydrogen_y, -0.8792512},  {AOL::S1}                  },
+        elec::AtomInfo {elec::AtomLabel::H, coord::Cartesian3D {0.0, -1.4194772, -0.8792512}, {AOL::S1}                  }
+    };
+}
+
+inline auto get_h2o_basis() -> std::vector<elec::AtomicOrbitalInfoSTO3G>
+{
+    return elec::create_atomic_orbitals_sto3g(get_h2o_atoms());
+}
+
+/*
+    The options of a quiet restricted Hartree-Fock calculation on the water molecule, starting from the
+    core Hamiltonian; the tests change whichever options they are about.
+*/
+inline auto water_options() -> elec::RestrictedHartreeFockOptions
+{
+    return elec::RestrictedHartreeFockOptions {
+        .initial_fock = elec::InitialFockGuess::CORE_HAMILTONIAN_MATRIX,
+        .n_electrons = 10,
+        .n_max_iter = 100,
+        .tolerance_change_density_matrix = 1.0e-8,
+        .is_verbose = elec::Verbose::FALSE
+    };
+}
+
+/*
+    A symmetric matrix with no particular structure, to stand in for a density matrix.
+*/
+inline auto fake_density_matrix(std::size_t size, double phase) -> Eigen::MatrixXd
+{
+    const auto size_eig = static_cast<Eigen::Index>(size);
+    auto output = Eigen::MatrixXd {size_eig, size_eig};
+
+    for (Eigen::Index i0 {0}; i0 < size_eig; ++i0) {
+        for (Eigen::Index i1 {0}; i1 < size_eig; ++i1) {
+            const auto x0 = static_cast<double>(i0);
+            const auto x1 = static_cast<double>(i1);
+            output(i0, i1) = std::cos(x0 + 2.0 * x1 + phase) + std::cos(x1 + 2.0 * x0 + phase);
+        }
+    }
+
+    return output;
+}
+
+}  // namespace elec_test
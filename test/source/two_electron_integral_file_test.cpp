@@ -0,0 +1,180 @@
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "elecstruct/integrals/schwarz_screening.hpp"
+#include "elecstruct/integrals/shell_pair_data.hpp"
+#include "elecstruct/integrals/two_electron_integral_file.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+#include "elecstruct/matrices.hpp"
+#include "elecstruct/orbitals.hpp"
+
+#include "test_fixtures.hpp"
+
+namespace
+{
+
+auto temporary_path(const std::string& name) -> std::filesystem::path
+{
+    return std::filesystem::temp_directory_path() / ("elecstruct_test_" + name + ".bin");
+}
+
+}  // anonymous namespace
+
+TEST_CASE("packing the indices of a quartet")
+{
+    const auto quartet = GENERATE(
+        elec::TwoElectronIntegralQuartet {0, 0, 0, 0},
+        elec::TwoElectronIntegralQuartet {3, 2, 1, 0},
+        elec::TwoElectronIntegralQuartet {65535, 1, 65535, 2},
+        elec::TwoElectronIntegralQuartet {65535, 65535, 65535, 65535}
+    );
+
+    const auto packed = elec::pack_quartet_indices(quartet.i0, quartet.i1, quartet.i2, quartet.i3);
+    const auto unpacked = elec::unpack_quartet_indices(packed);
+
+    REQUIRE(unpacked.i0 == quartet.i0);
+    REQUIRE(unpacked.i1 == quartet.i1);
+    REQUIRE(unpacked.i2 == quartet.i2);
+    REQUIRE(unpacked.i3 == quartet.i3);
+}
+
+TEST_CASE("two-electron integral file")
+{
+    const auto basis = elec_test::get_h2o_basis();
+    const auto shell_pairs = elec::ShellPairData {basis};
+    const auto size = basis.size();
+
+    SECTION("the records match the stored integrals")
+    {
+        const auto path = temporary_path("water_records");
+        const auto screening = elec::SchwarzScreening {shell_pairs, 1.0e-6};
+        const auto n_skipped = elec::write_two_electron_integral_file(path, shell_pairs, screening);
+
+        const auto grid = elec::two_electron_integral_grid(shell_pairs);
+
+        {
+            const auto reader = elec::TwoElectronIntegralFileReader {path};
+            REQUIRE(reader.n_basis_functions() == size);
+            REQUIRE(reader.n_records() + n_skipped == elec::n_unique_quartets(size));
+            REQUIRE(reader.n_blocks() == 1);
+
+            for (const auto block : reader) {
+                for (const auto& record : block) {
+                    const auto [i0, i1, i2, i3] = elec::unpack_quartet_indices(record.packed_indices);
+                    REQUIRE(!screening.is_negligible(i0, i1, i2, i3));
+                    REQUIRE(record.value == grid.get(i0, i1, i2, i3));
+                }
+            }
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("the streamed two-electron matrix matches the matrix built from the stored integrals")
+    {
+        const auto path = temporary_path("water_matrix");
+        const auto no_screening = elec::SchwarzScreening {shell_pairs, 0.0};
+        elec::write_two_electron_integral_file(path, shell_pairs, no_screening);
+
+        const auto density_mtx = elec_test::fake_density_matrix(size, 0.7);
+        const auto grid = elec::two_electron_integral_grid(shell_pairs);
+        const auto expected = elec::electron_electron_matrix(basis, density_mtx, grid);
+
+        {
+            const auto reader = elec::TwoElectronIntegralFileReader {path};
+            const auto actual = elec::electron_electron_matrix(reader, density_mtx);
+
+            REQUIRE(actual.isApprox(expected, 1.0e-12));
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("records are split across several blocks")
+    {
+        const auto path = temporary_path("blocks");
+        const auto n_records = 2 * elec::RECORDS_PER_BLOCK + 17;
+
+        {
+            auto writer = elec::TwoElectronIntegralFileWriter {path, 4};
+            for (std::size_t i {0}; i < n_records; ++i) {
+                writer.write(i % 4, (i / 4) % 4, (i / 16) % 4, (i / 64) % 4, static_cast<double>(i));
+            }
+            writer.close();
+
+            REQUIRE(writer.n_records() == n_records);
+        }
+
+        {
+            const auto reader = elec::TwoElectronIntegralFileReader {path};
+            REQUIRE(reader.n_records() == n_records);
+            REQUIRE(reader.n_blocks() == 3);
+
+            auto block_sizes = std::vector<std::size_t> {};
+            auto i_record = std::size_t {0};
+            for (const auto block : reader) {
+                block_sizes.push_back(block.size());
+
+                for (const auto& record : block) {
+                    const auto [i0, i1, i2, i3] = elec::unpack_quartet_indices(record.packed_indices);
+                    REQUIRE(i0 == i_record % 4);
+                    REQUIRE(i3 == (i_record / 64) % 4);
+                    REQUIRE(record.value == static_cast<double>(i_record));
+                    ++i_record;
+                }
+            }
+
+            const auto expected_block_sizes =
+                std::vector<std::size_t> {elec::RECORDS_PER_BLOCK, elec::RECORDS_PER_BLOCK, 17};
+            REQUIRE(block_sizes == expected_block_sizes);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("an empty file has no blocks")
+    {
+        const auto path = temporary_path("empty");
+
+        {
+            auto writer = elec::TwoElectronIntegralFileWriter {path, 4};
+        }
+
+        {
+            const auto reader = elec::TwoElectronIntegralFileReader {path};
+            REQUIRE(reader.n_records() == 0);
+            REQUIRE(reader.n_blocks() == 0);
+            REQUIRE(reader.begin() == reader.end());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("throws for a file that is not a two-electron integral file")
+    {
+        const auto path = temporary_path("invalid");
+
+        {
+            auto stream = std::ofstream {path};
+            stream << "this is not a two-electron integral file, but it is long enough to hold a header\n";
+        }
+
+        REQUIRE_THROWS_AS(elec::TwoElectronIntegralFileReader {path}, std::runtime_error);
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("throws for a file that does not exist")
+    {
+        const auto path = temporary_path("does_not_exist");
+        REQUIRE_THROWS_AS(elec::TwoElectronIntegralFileReader {path}, std::runtime_error);
+    }
+}
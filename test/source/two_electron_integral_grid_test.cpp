@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <tuple>
 #include <vector>
 
@@ -6,6 +7,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include "elecstruct/integrals/two_electron_integral_grid.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
 
 using Indices = std::tuple<std::size_t, std::size_t, std::size_t, std::size_t>;
 
@@ -218,3 +220,47 @@ TEST_CASE("two_electron_integral_grid")
         ));
     }
 }
+
+TEST_CASE("two_electron_integral_grid with preallocated storage")
+{
+    const auto n_basis_functions = std::size_t {4};
+
+    SECTION("storage holds exactly one element per unique quartet")
+    {
+        const auto grid = elec::TwoElectronIntegralGrid {n_basis_functions};
+
+        REQUIRE(grid.size() == elec::n_unique_quartets(n_basis_functions));
+        REQUIRE(grid.values().size() == grid.size());
+        REQUIRE(!grid.exists(3, 2, 1, 0));
+    }
+
+    SECTION("storage is aligned to a cache line")
+    {
+        const auto grid = elec::TwoElectronIntegralGrid {n_basis_functions};
+        const auto address = reinterpret_cast<std::uintptr_t>(grid.values().data());
+
+        REQUIRE(address % elec::TwoElectronIntegralGrid::ALIGNMENT == 0);
+    }
+
+    SECTION("bulk view matches the order of the unique quartets")
+    {
+        auto grid = elec::TwoElectronIntegralGrid {n_basis_functions};
+
+        auto counter = double {0.0};
+        for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {n_basis_functions}) {
+            grid.set(i0, i1, i2, i3, counter);
+            counter += 1.0;
+        }
+
+        const auto values = grid.values();
+
+        auto expected = double {0.0};
+        for (const auto value : values) {
+            REQUIRE_THAT(value, Catch::Matchers::WithinAbs(expected, 1.0e-12));
+            expected += 1.0;
+        }
+
+        const auto i_yoshimine = elec::yoshimine_sort(1, 0, 0, 1);
+        REQUIRE_THAT(grid.get(0, 1, 1, 0), Catch::Matchers::WithinAbs(values[i_yoshimine], 1.0e-12));
+    }
+}
@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "elecstruct/integrals/two_electron_integral_grid.hpp"
+#include "elecstruct/integrals/unique_quartet_iterator.hpp"
+
+auto quartets_via_custom_iterator(std::size_t n_basis_functions) -> std::vector<elec::TwoElectronIntegralQuartet>
+{
+    auto output = std::vector<elec::TwoElectronIntegralQuartet> {};
+
+    for (const auto quartet : elec::UniqueQuartetGenerator {n_basis_functions}) {
+        output.push_back(quartet);
+    }
+
+    return output;
+}
+
+TEST_CASE("unique quartet iterator")
+{
+    SECTION("empty basis produces no quartets")
+    {
+        const auto quartets = quartets_via_custom_iterator(0);
+        REQUIRE(quartets.empty());
+    }
+
+    SECTION("single basis function produces a single quartet")
+    {
+        const auto quartets = quartets_via_custom_iterator(1);
+
+        REQUIRE(quartets.size() == 1);
+        REQUIRE(quartets[0] == elec::TwoElectronIntegralQuartet {0, 0, 0, 0});
+    }
+
+    SECTION("quartets are canonical, and appear in order of their Yoshimine index")
+    {
+        const auto n_basis_functions = GENERATE(std::size_t {2}, std::size_t {3}, std::size_t {5}, std::size_t {8});
+        const auto quartets = quartets_via_custom_iterator(n_basis_functions);
+
+        REQUIRE(quartets.size() == elec::n_unique_quartets(n_basis_functions));
+
+        for (std::size_t i {0}; i < quartets.size(); ++i) {
+            const auto [i0, i1, i2, i3] = quartets[i];
+            REQUIRE(i0 >= i1);
+            REQUIRE(i2 >= i3);
+            REQUIRE(i0 * (i0 + 1) / 2 + i1 >= i2 * (i2 + 1) / 2 + i3);
+            REQUIRE(elec::yoshimine_sort(i0, i1, i2, i3) == i);
+        }
+    }
+
+    SECTION("every quartet from the full nested loops is represented exactly once")
+    {
+        const auto n_basis_functions = std::size_t {4};
+
+        auto yoshimine_from_full_loops = std::set<std::size_t> {};
+        for (std::size_t i0 {0}; i0 < n_basis_functions; ++i0)
+            for (std::size_t i1 {0}; i1 < n_basis_functions; ++i1)
+                for (std::size_t i2 {0}; i2 < n_basis_functions; ++i2)
+                    for (std::size_t i3 {0}; i3 < n_basis_functions; ++i3) {
+                        yoshimine_from_full_loops.insert(elec::yoshimine_sort(i0, i1, i2, i3));
+                    }
+
+        auto yoshimine_from_iterator = std::set<std::size_t> {};
+        for (const auto [i0, i1, i2, i3] : elec::UniqueQuartetGenerator {n_basis_functions}) {
+            yoshimine_from_iterator.insert(elec::yoshimine_sort(i0, i1, i2, i3));
+        }
+
+        REQUIRE(yoshimine_from_full_loops == yoshimine_from_iterator);
+    }
+}
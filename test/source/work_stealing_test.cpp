@@ -0,0 +1,60 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "elecstruct/parallel/work_stealing.hpp"
+
+TEST_CASE("work stealing")
+{
+    SECTION("every task is run exactly once")
+    {
+        const auto n_threads = GENERATE(std::size_t {1}, std::size_t {3}, std::size_t {64});
+        const auto n_tasks = std::size_t {50};
+
+        auto counts = std::vector<std::atomic<int>>(n_tasks);
+
+        auto tasks = std::vector<elec::parallel::WeightedTask> {};
+        for (std::size_t i {0}; i < n_tasks; ++i) {
+            const auto cost = static_cast<double>(i % 7);
+            tasks.push_back({cost, [&counts, i]() { ++counts[i]; }});
+        }
+
+        elec::parallel::run_work_stealing(std::move(tasks), n_threads);
+
+        for (const auto& count : counts) {
+            REQUIRE(count.load() == 1);
+        }
+    }
+
+    SECTION("no tasks is not an error")
+    {
+        REQUIRE_NOTHROW(elec::parallel::run_work_stealing({}, 4));
+    }
+
+    SECTION("zero threads throws")
+    {
+        auto tasks = std::vector<elec::parallel::WeightedTask> {};
+        tasks.push_back({1.0, []() {}});
+
+        REQUIRE_THROWS_AS(elec::parallel::run_work_stealing(std::move(tasks), 0), std::runtime_error);
+    }
+
+    SECTION("an exception thrown by a task is rethrown after all threads finish")
+    {
+        auto n_finished = std::atomic<int> {0};
+
+        auto tasks = std::vector<elec::parallel::WeightedTask> {};
+        tasks.push_back({1.0, []() { throw std::runtime_error {"task failed"}; }});
+        for (int i {0}; i < 10; ++i) {
+            tasks.push_back({1.0, [&n_finished]() { ++n_finished; }});
+        }
+
+        REQUIRE_THROWS_AS(elec::parallel::run_work_stealing(std::move(tasks), 3), std::runtime_error);
+        REQUIRE(n_finished.load() == 10);
+    }
+}